@@ -3,27 +3,89 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace robotick
 {
-	// DEFAULT_MAX_BLACKBOARDS_BYTES
+	// DEFAULT_CACHE_LINE_BYTES
+	//
+	// Cache-line size assumed when keeping data written by different threads apart (e.g. WorkloadsLayout::CacheAware).
+	// The WorkloadsBuffer itself is allocated on this boundary, so offsets aligned to it are aligned in memory too.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr size_t DEFAULT_CACHE_LINE_BYTES = 64;
+#else
+	constexpr size_t DEFAULT_CACHE_LINE_BYTES = 32; // ESP32-S3 data cache line
+#endif
+
+	// DEFAULT_MAX_WORKER_THREADS / DEFAULT_WORKER_QUEUE_CAPACITY
+	//
+	// Upper bound on the engine-owned WorkerPool (see Model::set_worker_thread_count), and the fixed number of
+	// tasks each worker can have queued at once. Queues never grow - a full queue runs the task inline instead.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr uint32_t DEFAULT_MAX_WORKER_THREADS = 64;
+	constexpr size_t DEFAULT_WORKER_QUEUE_CAPACITY = 256;
+#else
+	constexpr uint32_t DEFAULT_MAX_WORKER_THREADS = 2;
+	constexpr size_t DEFAULT_WORKER_QUEUE_CAPACITY = 32;
+#endif
+
+	// DEFAULT_MAX_HYPERPERIOD_SLOTS
 	//
-	// During engine setup, we construct all workloads into a single WorkloadsBuffer.
-	// However, we can only determine blackboard memory requirements *after*
-	// constructing and pre-loading the workloads (since that's when PythonWorkloads
-	// or other dynamic workloads reveal their schema).
+	// TickSchedulingMode::Hyperperiod builds one dispatch slot per root tick across the least common multiple of all rate
+	// divisors. Models whose rates don't share a small common multiple are rejected at load rather than silently using a
+	// huge table.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr uint32_t DEFAULT_MAX_HYPERPERIOD_SLOTS = 65536;
+#else
+	constexpr uint32_t DEFAULT_MAX_HYPERPERIOD_SLOTS = 1024;
+#endif
+
+	// DEFAULT_MAX_SCHEDULED_ENGINES
 	//
-	// To solve this "chicken-and-egg" problem, we pre-reserve an estimated maximum
-	// number of bytes for all blackboards, appended after the workloads.
-	// This lets us compute and bind blackboards in-place after preload, without
-	// reallocating or copying buffers — a simple, robust fix for all platforms.
+	// Upper bound on the number of Engines one EngineScheduler can multiplex. Its per-engine state is held inline, so
+	// adding engines never allocates.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr uint32_t DEFAULT_MAX_SCHEDULED_ENGINES = 64;
+#else
+	constexpr uint32_t DEFAULT_MAX_SCHEDULED_ENGINES = 4;
+#endif
+
+	// DEFAULT_MAX_IO_WATCHES
+	//
+	// Upper bound on the file descriptors an Engine's IoReactor can watch for async workloads at once. Watches are held
+	// inline, so registering one never allocates.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr uint32_t DEFAULT_MAX_IO_WATCHES = 64;
+#else
+	constexpr uint32_t DEFAULT_MAX_IO_WATCHES = 8;
+#endif
+
+	// DEFAULT_ARENA_CHUNK_BYTES
+	//
+	// Size of each chunk an Engine's MemoryArena (see Model::set_state_arena_enabled) reserves as its workloads load. Bigger
+	// requests get a chunk of their own, so this only bounds the memory left unused at the end of the last chunk.
+
+#if defined(ROBOTICK_PLATFORM_DESKTOP)
+	constexpr size_t DEFAULT_ARENA_CHUNK_BYTES = 256 * 1024;
+#else
+	constexpr size_t DEFAULT_ARENA_CHUNK_BYTES = 8 * 1024;
+#endif
+
+	// DEFAULT_WATCHDOG_POLL_INTERVAL_MS
 	//
-	// If this default is too small, a runtime exception will be thrown. You can
-	// override it with a config option per deployment target.
+	// How often the watchdog thread checks the ticks of workloads with a WorkloadWatchdogSeed (only started if there are any).
+	// A budget is therefore only enforced to within this interval - keep budgets comfortably above it.
 
 #if defined(ROBOTICK_PLATFORM_DESKTOP)
-	constexpr size_t DEFAULT_MAX_BLACKBOARDS_BYTES = 512 * 1024; // 512 KB
+	constexpr uint32_t DEFAULT_WATCHDOG_POLL_INTERVAL_MS = 2;
 #else
-	constexpr size_t DEFAULT_MAX_BLACKBOARDS_BYTES = 0; // no blackboards on other platforms (e.g. embedded)
+	constexpr uint32_t DEFAULT_WATCHDOG_POLL_INTERVAL_MS = 10;
 #endif
 
 } // namespace robotick
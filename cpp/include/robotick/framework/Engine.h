@@ -6,13 +6,21 @@
 #include "robotick/api.h"
 #include "robotick/framework/WorkloadInstanceInfo.h"
 #include "robotick/framework/containers/Map.h"
+#include "robotick/framework/time/Clock.h"
 #include "robotick/framework/utils/TypeId.h"
 
 namespace robotick
 {
 	class AtomicFlag;
+	class DirtyRegionTracker;
+	class IoReactor;
+	class MemoryArena;
 	class Model;
+	class TickPlan;
+	class Watchdog;
+	class WorkerPool;
 	class WorkloadsBuffer;
+	class WorkloadsBufferSnapshots;
 	struct DataConnectionInfo;
 	struct StructDescriptor;
 	struct TickInfo;
@@ -30,8 +38,42 @@ namespace robotick
 
 		void run(const AtomicFlag&&) = delete; // cause compile-error if a temporary is used
 
+		// As run(), but driven by a virtual clock advancing exactly 1/tick_rate_hz per tick and never sleeping - so simulations run
+		// as fast as the CPU allows, with identical TickInfo timing on every run. Stops after max_ticks ticks (0 = no limit).
+		void run_virtual_time(const AtomicFlag& stop_after_next_tick_flag, uint64_t max_ticks = 0);
+
+		void run_virtual_time(const AtomicFlag&&, uint64_t = 0) = delete;
+
 		bool is_running() const;
 
+		// Asks a run in progress on another thread to stop - waking it if it is sleeping until its next tick, else stopping after
+		// the current one - and waits up to timeout for it to finish. Returns whether it has. With nothing running it returns
+		// true at once, and the request stops the next run (after its first tick) instead - so a stop() racing a run's start
+		// is never lost.
+		bool stop(Clock::duration timeout);
+
+		// Set by stop(), or once a watched workload's WatchdogAction::Stop has tripped - the run then stops after its current tick.
+		bool is_stop_requested() const;
+
+		// Saves the workloads' state from a consistent frame to path (see WorkloadsCheckpoint). While running, the tick thread just
+		// copies it out at the end of its next frame, and the calling thread (never the tick thread) writes the file. Returns whether
+		// it was written.
+		bool save_checkpoint(const char* path);
+
+		// Restores a checkpoint saved from the same model - after load(), before running. Returns false, restoring nothing, if there
+		// is no checkpoint at path or it doesn't match this engine's layout.
+		bool restore_checkpoint(const char* path);
+
+	  public: // stepped api - run() is built from these; EngineScheduler uses them to multiplex several engines on one thread
+		// Starts a real-time run (start_fn, telemetry, etc.) and returns when the first tick is due. The caller's wake_flag (if any)
+		// is what it sleeps on between steps, which stop() wakes.
+		Clock::time_point begin_stepped_run(const AtomicFlag* wake_flag = nullptr);
+
+		// Ticks one frame now (applying the model's overrun policy) and returns when the next tick is due.
+		Clock::time_point step();
+
+		void end_stepped_run();
+
 		const char* get_model_name() const;
 
 	  public: // internal public accessors
@@ -54,7 +96,40 @@ namespace robotick
 
 		WorkloadsBuffer& get_workloads_buffer() const;
 
+		// Copies of the buffer published after every frame, for other threads to read (only initialized if the model asks for any).
+		WorkloadsBufferSnapshots& get_workloads_buffer_snapshots() const;
+
+		// What the current (or, between frames, last) frame wrote to the buffer - only initialized if the model enables tracking.
+		DirtyRegionTracker& get_dirty_regions() const;
+
+		// Where load() allocated the workloads' state (see Model::set_state_arena_enabled) - empty unless the model enables it.
+		const MemoryArena& get_state_arena() const;
+
+		// Flattened workload tree compiled during load(); group workloads may use it to tick their children.
+		TickPlan& get_tick_plan() const;
+
+		// Engine-owned worker pool (see Model::set_worker_thread_count), or nullptr if the model doesn't use one.
+		WorkerPool* get_worker_pool() const;
+
+		// Readiness reactor polled at the start of every frame, on which async workloads watch their fds (see AsyncTick.h).
+		IoReactor& get_io_reactor() const;
+
+		// Polices the budgets of the model's watched workloads (see WorkloadWatchdogSeed) while the engine runs.
+		Watchdog& get_watchdog() const;
+
+		// Tells the tick plan that the workload owning field_ptr has new inputs (waking it if event-driven). Tick thread only.
+		void notify_input_written(const void* field_ptr) const;
+
 	  private:
+		// shared by run() and run_virtual_time(), which differ only in how they advance time between frames:
+		float begin_run();
+		void tick_frame(const TickInfo& tick_info, uint32_t delta_ns, uint32_t budget_ns);
+		void finish_run();
+
+		using LoadStepFn = void (*)(Engine& engine, WorkloadInstanceInfo& instance);
+
+		void run_load_phase(const char* phase_name, LoadStepFn load_step, uint64_t WorkloadLoadTimings::*timing_ns);
+
 		void bind_blackboards_in_struct(WorkloadInstanceInfo& workload_instance_info,
 			const TypeDescriptor& struct_type_desc,
 			const size_t struct_offset,
@@ -62,6 +137,7 @@ namespace robotick
 		void bind_blackboards_for_instances(HeapVector<WorkloadInstanceInfo>& instances, const size_t blackboards_data_start_offset);
 
 		size_t compute_blackboard_memory_requirements(const HeapVector<WorkloadInstanceInfo>& instances);
+		void relocate_workloads_buffer(const Model& model, const size_t buffer_capacity);
 
 	  private:
 		struct State;
@@ -14,6 +14,8 @@ namespace robotick
 {
 	class Engine;
 	struct TypeDescriptor;
+	struct WorkloadPlacementSeed;
+	struct WorkloadWatchdogSeed;
 	struct WorkloadSeed;
 	struct WorkloadsBuffer;
 	struct WorkloadDescriptor;
@@ -35,8 +37,19 @@ namespace robotick
 		uint32_t duration_window_index = 0;
 		uint32_t delta_window_index = 0;
 		uint32_t overrun_count = 0;
+		uint32_t missed_deadline_count = 0; // ticks that finished after the next tick was due (root only - see OverrunPolicy)
+		uint32_t last_wake_jitter_ns = 0;	// how late the tick timer woke for the latest tick (root only - see TickTimerBackend)
+		uint32_t max_wake_jitter_ns = 0;
+		uint32_t watchdog_trip_count = 0; // ticks the watchdog caught running past their budget (see WorkloadWatchdogSeed)
+		uint64_t skipped_tick_count = 0;  // due ticks skipped as disabled (see TickPlan::set_entry_enabled) or idle (has_work())
 
 		void record_tick_sample(uint32_t duration_ns, uint32_t delta_ns, uint32_t budget_ns);
+		void record_wake_jitter(uint32_t jitter_ns)
+		{
+			last_wake_jitter_ns = jitter_ns;
+			if (jitter_ns > max_wake_jitter_ns)
+				max_wake_jitter_ns = jitter_ns;
+		}
 
 		float get_last_tick_duration_sec() const { return (float)last_tick_duration_ns * 1e-9f; }
 		float get_last_time_delta_sec() const { return (float)last_time_delta_ns * 1e-9f; }
@@ -53,22 +66,55 @@ namespace robotick
 		size_t get_duration_window_count() const { return duration_window.size(); }
 	};
 
+	// Wall-clock time each load-phase callback took for a workload (recorded by Engine::load, whether or not it ran in parallel)
+	struct WorkloadLoadTimings
+	{
+		uint64_t construct_ns = 0; // (64-bit, as loads can take longer than the ~4.3s a uint32_t holds)
+		uint64_t pre_load_ns = 0;  // includes set_engine and the first config pass
+		uint64_t load_ns = 0;
+		uint64_t setup_ns = 0;
+	};
+
 	struct WorkloadInstanceInfo
 	{
 		uint8_t* get_ptr(const Engine& engine) const;
 		uint8_t* get_ptr(WorkloadsBuffer& workloads_buffer) const;
 
+		// size of all of its elements (just the one, unless instanced - in which case get_ptr() returns the first)
+		size_t get_size() const;
+		size_t get_element_size() const;
+
+		template <typename ElementFn> void for_each_element(uint8_t* first_element_ptr, ElementFn element_fn) const;
+
 		// constant once created:
 		const WorkloadSeed* seed = nullptr;
 		const TypeDescriptor* type = nullptr;
 		const WorkloadDescriptor* workload_descriptor = nullptr;
 		size_t offset_in_workloads_buffer = OFFSET_UNBOUND;
+		const WorkloadPlacementSeed* placement = nullptr; // only set on workloads named by one of the model's placements
+		uint32_t instance_count = 1;					  // elements in an instanced workload's array (see WorkloadSeed)
+		const WorkloadWatchdogSeed* watchdog = nullptr;	  // only set on workloads named by one of the model's watchdogs
 
 		HeapVector<const WorkloadInstanceInfo*> children;
 
 		WorkloadInstanceStats* workload_stats = nullptr;
+
+		WorkloadLoadTimings load_timings;
+
+		// blackboard storage bound to its outputs (one range - a struct's blackboards are bound back to back), set during load
+		size_t outputs_storage_offset = 0;
+		size_t outputs_storage_size = 0;
 	};
 
+	template <typename ElementFn> void WorkloadInstanceInfo::for_each_element(uint8_t* first_element_ptr, ElementFn element_fn) const
+	{
+		const size_t element_size = get_element_size();
+		for (uint32_t element_index = 0; element_index < instance_count; ++element_index)
+		{
+			element_fn(first_element_ptr + element_index * element_size);
+		}
+	}
+
 	inline void WorkloadInstanceStats::record_tick_sample(uint32_t duration_ns, uint32_t delta_ns, uint32_t budget_ns)
 	{
 		if (budget_ns == 0)
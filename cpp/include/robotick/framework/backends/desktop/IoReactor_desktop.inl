@@ -0,0 +1,129 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <sys/select.h>
+#endif
+
+namespace robotick
+{
+#if defined(__linux__)
+
+	inline bool IoReactor::add_to_poll_set(uint32_t watch_id)
+	{
+		if (poll_handle < 0)
+		{
+			poll_handle = ::epoll_create1(EPOLL_CLOEXEC);
+			if (poll_handle < 0)
+				return false;
+		}
+
+		epoll_event event{};
+		const uint32_t events = watches[watch_id].events;
+		event.events = ((events & IoEvents::Readable) ? EPOLLIN : 0u) | ((events & IoEvents::Writable) ? EPOLLOUT : 0u);
+		event.data.u32 = watch_id;
+		return ::epoll_ctl(poll_handle, EPOLL_CTL_ADD, watches[watch_id].fd, &event) == 0;
+	}
+
+	inline void IoReactor::remove_from_poll_set(uint32_t watch_id)
+	{
+		::epoll_ctl(poll_handle, EPOLL_CTL_DEL, watches[watch_id].fd, nullptr);
+	}
+
+	inline void IoReactor::close_poll_handle()
+	{
+		if (poll_handle >= 0)
+			::close(poll_handle);
+		poll_handle = -1;
+	}
+
+	inline void IoReactor::poll(WakeFn wake_fn, void* context)
+	{
+		if (watch_count == 0)
+			return;
+
+		// one syscall per frame, however many fds are watched; errors/hang-ups count as ready so the owner sees them on read
+		epoll_event events[DEFAULT_MAX_IO_WATCHES];
+		const int ready_count = ::epoll_wait(poll_handle, events, static_cast<int>(DEFAULT_MAX_IO_WATCHES), 0);
+		for (int i = 0; i < ready_count; ++i)
+		{
+			mark_ready(events[i].data.u32, wake_fn, context);
+		}
+	}
+
+#elif !defined(_WIN32)
+
+	// no epoll - every fd is checked with a single zero-timeout select() per frame
+
+	inline bool IoReactor::add_to_poll_set(uint32_t watch_id)
+	{
+		return watches[watch_id].fd < FD_SETSIZE;
+	}
+
+	inline void IoReactor::remove_from_poll_set(uint32_t)
+	{
+	}
+
+	inline void IoReactor::close_poll_handle()
+	{
+	}
+
+	inline void IoReactor::poll(WakeFn wake_fn, void* context)
+	{
+		if (watch_count == 0)
+			return;
+
+		fd_set read_fds;
+		fd_set write_fds;
+		FD_ZERO(&read_fds);
+		FD_ZERO(&write_fds);
+
+		int max_fd = -1;
+		for (const Watch& active_watch : watches)
+		{
+			if (!active_watch.is_active)
+				continue;
+			if (active_watch.events & IoEvents::Readable)
+				FD_SET(active_watch.fd, &read_fds);
+			if (active_watch.events & IoEvents::Writable)
+				FD_SET(active_watch.fd, &write_fds);
+			max_fd = (active_watch.fd > max_fd) ? active_watch.fd : max_fd;
+		}
+
+		timeval no_wait{};
+		if (::select(max_fd + 1, &read_fds, &write_fds, nullptr, &no_wait) <= 0)
+			return;
+
+		for (uint32_t watch_id = 0; watch_id < DEFAULT_MAX_IO_WATCHES; ++watch_id)
+		{
+			const Watch& active_watch = watches[watch_id];
+			if (active_watch.is_active && (FD_ISSET(active_watch.fd, &read_fds) || FD_ISSET(active_watch.fd, &write_fds)))
+				mark_ready(watch_id, wake_fn, context);
+		}
+	}
+
+#else
+
+	inline bool IoReactor::add_to_poll_set(uint32_t)
+	{
+		return false; // not yet supported on Windows
+	}
+
+	inline void IoReactor::remove_from_poll_set(uint32_t)
+	{
+	}
+
+	inline void IoReactor::close_poll_handle()
+	{
+	}
+
+	inline void IoReactor::poll(WakeFn, void*)
+	{
+	}
+
+#endif
+
+} // namespace robotick
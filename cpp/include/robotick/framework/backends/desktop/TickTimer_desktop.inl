@@ -0,0 +1,97 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/memory/StdApproved.h"
+
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace robotick
+{
+#if defined(__linux__)
+	namespace detail
+	{
+		// steady_clock is CLOCK_MONOTONIC on Linux, so its time_points can be handed straight to the kernel as absolute deadlines
+		inline timespec to_monotonic_timespec(Clock::time_point time_point)
+		{
+			const int64_t ns = Clock::to_nanoseconds(time_point.time_since_epoch()).count();
+			timespec result{};
+			result.tv_sec = static_cast<time_t>(ns / 1000000000);
+			result.tv_nsec = static_cast<long>(ns % 1000000000);
+			return result;
+		}
+	} // namespace detail
+#endif
+
+	inline void TickTimer::start(TickTimerBackend in_backend)
+	{
+		stop();
+		backend = in_backend;
+
+		if (backend != TickTimerBackend::TimerFd)
+			return;
+
+#if defined(__linux__)
+		timer_fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+		if (timer_fd < 0)
+		{
+			ROBOTICK_WARNING("TickTimer: timerfd_create failed (errno %d) - using AbsoluteSleep instead", errno);
+			backend = TickTimerBackend::AbsoluteSleep;
+		}
+#else
+		backend = TickTimerBackend::AbsoluteSleep;
+#endif
+	}
+
+	inline void TickTimer::stop()
+	{
+#if defined(__linux__)
+		if (timer_fd >= 0)
+			::close(timer_fd);
+#endif
+		timer_fd = -1;
+	}
+
+	inline void TickTimer::sleep_absolute(Clock::time_point target_time)
+	{
+#if defined(__linux__)
+		const timespec deadline = detail::to_monotonic_timespec(target_time);
+		while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR)
+		{
+		}
+#else
+		std_approved::this_thread::sleep_until(target_time);
+#endif
+	}
+
+	inline void TickTimer::sleep_timer_fd(Clock::time_point target_time)
+	{
+#if defined(__linux__)
+		itimerspec timer_spec{};
+		timer_spec.it_value = detail::to_monotonic_timespec(target_time);
+		if (timer_spec.it_value.tv_sec == 0 && timer_spec.it_value.tv_nsec == 0)
+			timer_spec.it_value.tv_nsec = 1; // an all-zero it_value would disarm the timer rather than fire it
+
+		if (::timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &timer_spec, nullptr) != 0)
+		{
+			sleep_absolute(target_time);
+			return;
+		}
+
+		// a deadline already in the past fires immediately; the read returns the expiration count, which we don't need
+		uint64_t expirations = 0;
+		while (::read(timer_fd, &expirations, sizeof(expirations)) < 0 && errno == EINTR)
+		{
+		}
+#else
+		sleep_absolute(target_time);
+#endif
+	}
+
+} // namespace robotick
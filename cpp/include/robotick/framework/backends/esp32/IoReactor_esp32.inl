@@ -0,0 +1,57 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include <sys/select.h>
+
+namespace robotick
+{
+	// no epoll on ESP-IDF - every fd (socket, UART VFS, etc.) is checked with a single zero-timeout select() per frame
+
+	inline bool IoReactor::add_to_poll_set(uint32_t watch_id)
+	{
+		return watches[watch_id].fd < FD_SETSIZE;
+	}
+
+	inline void IoReactor::remove_from_poll_set(uint32_t)
+	{
+	}
+
+	inline void IoReactor::close_poll_handle()
+	{
+	}
+
+	inline void IoReactor::poll(WakeFn wake_fn, void* context)
+	{
+		if (watch_count == 0)
+			return;
+
+		fd_set read_fds;
+		fd_set write_fds;
+		FD_ZERO(&read_fds);
+		FD_ZERO(&write_fds);
+
+		int max_fd = -1;
+		for (const Watch& active_watch : watches)
+		{
+			if (!active_watch.is_active)
+				continue;
+			if (active_watch.events & IoEvents::Readable)
+				FD_SET(active_watch.fd, &read_fds);
+			if (active_watch.events & IoEvents::Writable)
+				FD_SET(active_watch.fd, &write_fds);
+			max_fd = (active_watch.fd > max_fd) ? active_watch.fd : max_fd;
+		}
+
+		timeval no_wait{};
+		if (::select(max_fd + 1, &read_fds, &write_fds, nullptr, &no_wait) <= 0)
+			return;
+
+		for (uint32_t watch_id = 0; watch_id < DEFAULT_MAX_IO_WATCHES; ++watch_id)
+		{
+			const Watch& active_watch = watches[watch_id];
+			if (active_watch.is_active && (FD_ISSET(active_watch.fd, &read_fds) || FD_ISSET(active_watch.fd, &write_fds)))
+				mark_ready(watch_id, wake_fn, context);
+		}
+	}
+
+} // namespace robotick
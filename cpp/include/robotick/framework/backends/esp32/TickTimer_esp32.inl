@@ -0,0 +1,44 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "esp_timer.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <cstdint>
+
+namespace robotick
+{
+	// FreeRTOS has no timerfd, so TimerFd behaves as AbsoluteSleep here
+
+	inline void TickTimer::start(TickTimerBackend in_backend)
+	{
+		backend = (in_backend == TickTimerBackend::TimerFd) ? TickTimerBackend::AbsoluteSleep : in_backend;
+	}
+
+	inline void TickTimer::stop()
+	{
+	}
+
+	inline void TickTimer::sleep_absolute(Clock::time_point target_time)
+	{
+		const int64_t target_us = Clock::to_nanoseconds(target_time.time_since_epoch()).count() / 1000;
+		const int64_t tick_period_us = static_cast<int64_t>(portTICK_PERIOD_MS) * 1000;
+
+		// block for whole RTOS ticks (leaving one in hand, as vTaskDelay can return up to a tick early), then spin the rest:
+		const int64_t remaining_us = target_us - esp_timer_get_time();
+		if (remaining_us > 2 * tick_period_us)
+			vTaskDelay(static_cast<TickType_t>(remaining_us / tick_period_us - 1));
+
+		while (esp_timer_get_time() < target_us)
+		{
+		}
+	}
+
+	inline void TickTimer::sleep_timer_fd(Clock::time_point target_time)
+	{
+		sleep_absolute(target_time);
+	}
+
+} // namespace robotick
@@ -0,0 +1,81 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+namespace robotick
+{
+	// What an async workload's tick() returns (a workload becomes async simply by returning this from tick()):
+	enum class AsyncTickStatus : uint8_t
+	{
+		Completed,	// the tick body ran to its end - the next due tick starts again from the top
+		Suspended,	// paused at an await/yield - the next due tick resumes it there
+		AwaitingIo	// paused on an IoReactor watch - skipped until the reactor (or new inputs) wakes it, then resumed there
+	};
+
+	// Resume point of an async workload's tick body. Lives in the workload, alongside anything the body needs across suspensions
+	// (locals do not survive an await).
+	struct AsyncTickState
+	{
+		uint32_t resume_point = 0;
+
+		bool is_suspended() const { return resume_point != 0; }
+		void reset() { resume_point = 0; }
+	};
+
+} // namespace robotick
+
+// Resumable tick bodies, protothread-style (we target C++17, so no coroutines): each await records its line as the resume point
+// and returns, and the next tick jumps straight back to it. Awaits may not be placed inside another switch statement.
+//
+//	AsyncTickStatus tick(const TickInfo&)
+//	{
+//		ROBOTICK_ASYNC_BEGIN(async_state);
+//		request_reading();
+//		ROBOTICK_ASYNC_AWAIT_IO(async_state, engine->get_io_reactor(), sensor_watch);
+//		read_reading();
+//		ROBOTICK_ASYNC_END(async_state);
+//	}
+
+#define ROBOTICK_ASYNC_BEGIN(state)                                                                                                                  \
+	switch ((state).resume_point)                                                                                                                    \
+	{                                                                                                                                                \
+	case 0:
+
+// Returns Suspended until condition holds - re-checked on every due tick
+#define ROBOTICK_ASYNC_AWAIT(state, condition)                                                                                                       \
+	do                                                                                                                                               \
+	{                                                                                                                                                \
+		(state).resume_point = __LINE__;                                                                                                             \
+		[[fallthrough]];                                                                                                                             \
+	case __LINE__:                                                                                                                                   \
+		if (!(condition))                                                                                                                            \
+			return robotick::AsyncTickStatus::Suspended;                                                                                             \
+	} while (0)
+
+// Returns AwaitingIo until the reactor reports watch_id ready - not ticked at all in between (see IoReactor)
+#define ROBOTICK_ASYNC_AWAIT_IO(state, reactor, watch_id)                                                                                            \
+	do                                                                                                                                               \
+	{                                                                                                                                                \
+		(state).resume_point = __LINE__;                                                                                                             \
+		[[fallthrough]];                                                                                                                             \
+	case __LINE__:                                                                                                                                   \
+		if (!(reactor).consume_ready(watch_id))                                                                                                      \
+			return robotick::AsyncTickStatus::AwaitingIo;                                                                                            \
+	} while (0)
+
+// Gives the rest of the tick body to the next due tick
+#define ROBOTICK_ASYNC_YIELD(state)                                                                                                                  \
+	do                                                                                                                                               \
+	{                                                                                                                                                \
+		(state).resume_point = __LINE__;                                                                                                             \
+		return robotick::AsyncTickStatus::Suspended;                                                                                                 \
+	case __LINE__:;                                                                                                                                  \
+	} while (0)
+
+#define ROBOTICK_ASYNC_END(state)                                                                                                                    \
+	}                                                                                                                                                \
+	(state).resume_point = 0;                                                                                                                        \
+	return robotick::AsyncTickStatus::Completed
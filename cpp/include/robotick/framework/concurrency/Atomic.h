@@ -4,8 +4,10 @@
 #pragma once
 
 #include "robotick/api_base.h"
+#include "robotick/framework/time/Clock.h"
 
 #include <atomic>
+#include <cstdint>
 #include <type_traits>
 
 namespace robotick
@@ -14,23 +16,49 @@ namespace robotick
 	{
 	  public:
 		explicit AtomicFlag(bool initial = false)
-			: flag(initial)
+			: flag(initial ? SET_BIT : 0u)
 		{
 		}
 
-		inline void set(bool value = true) { flag.store(value); }
-		inline void clear() { flag.store(false); }
-		inline bool is_set() const { return flag.load(); }
+		inline void set(bool value = true)
+		{
+			if (!value)
+			{
+				clear();
+				return;
+			}
+
+			// only pay for a wake (a syscall, on Linux) when someone has blocked in wait_until():
+			if (flag.fetch_or(SET_BIT) & WAITING_BIT)
+				wake_waiters();
+		}
+
+		inline void clear() { flag.fetch_and(~SET_BIT); }
+		inline bool is_set() const { return (flag.load() & SET_BIT) != 0; }
 
 		// Returns true if the flag was already set; false when we successfully claim it (now set).
 		inline bool test_and_set()
 		{
-			bool expected = false;
-			return !flag.compare_exchange_strong(expected, true);
+			const uint32_t previous = flag.fetch_or(SET_BIT);
+			if (previous & WAITING_BIT)
+				wake_waiters();
+			return (previous & SET_BIT) != 0;
 		}
 
+		/// @brief Blocks until the flag is set, wake_waiters() is called, or deadline passes - returning is_set().
+		/// Waits on a futex on Linux, so set() wakes the waiter within microseconds; elsewhere it re-checks every millisecond.
+		bool wait_until(Clock::time_point deadline) const;
+
+		/// @brief Wakes any thread blocked in wait_until() without setting the flag, so it can re-check other stop conditions
+		void wake_waiters() const;
+
 	  private:
-		std_approved::atomic<bool> flag{false};
+		static constexpr uint32_t SET_BIT = 1u << 0;
+		static constexpr uint32_t WAITING_BIT = 1u << 1; // sticky once anyone has waited, so later set()s keep waking
+		static constexpr uint32_t WAKE_COUNT_ONE = 1u << 2; // the remaining bits count wake_waiters() calls (wrapping)
+
+		// a 32-bit word (rather than atomic<bool>) so it can be waited on directly as a futex:
+		mutable std_approved::atomic<uint32_t> flag{0};
 	};
 
 	template <typename T> class AtomicValue
@@ -0,0 +1,149 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	struct IoEvents
+	{
+		static constexpr uint32_t Readable = 1u << 0;
+		static constexpr uint32_t Writable = 1u << 1;
+	};
+
+	/**
+	 * @brief Engine-owned readiness reactor for async workloads' file descriptors (epoll on Linux, select() elsewhere).
+	 *
+	 * The Engine polls it without blocking at the start of every frame. Each watch that has become ready is latched (until
+	 * consume_ready()) and its owner woken via Engine::notify_input_written(), so a workload suspended in
+	 * ROBOTICK_ASYNC_AWAIT_IO() resumes on its next due tick - and is skipped until then - instead of blocking the tick thread.
+	 *
+	 * Watches are held inline (up to DEFAULT_MAX_IO_WATCHES), and are only touched from the tick thread (or during load/setup).
+	 */
+	class IoReactor
+	{
+	  public:
+		static constexpr uint32_t INVALID_WATCH = 0xFFFFFFFFu;
+
+		using WakeFn = void (*)(void* context, const void* owner_ptr);
+
+		IoReactor() = default;
+		~IoReactor() { close_poll_handle(); }
+
+		IoReactor(const IoReactor&) = delete;
+		IoReactor& operator=(const IoReactor&) = delete;
+
+		/// @brief Starts watching fd for the given IoEvents; owner_ptr is any address within the workload to wake (normally `this`)
+		uint32_t watch(int fd, uint32_t events, const void* owner_ptr);
+		void unwatch(uint32_t watch_id);
+
+		/// @brief Returns whether the watch has become ready since it was last consumed, clearing it if so
+		bool consume_ready(uint32_t watch_id)
+		{
+			if (watch_id >= DEFAULT_MAX_IO_WATCHES || !watches[watch_id].is_ready)
+				return false;
+
+			watches[watch_id].is_ready = false;
+			return true;
+		}
+
+		/// @brief Gathers readiness without blocking, calling wake_fn for the owner of each watch that has newly become ready
+		void poll(WakeFn wake_fn, void* context);
+
+		uint32_t get_watch_count() const { return watch_count; }
+
+		/// @brief Moves the owner_ptr of each watch within [old_begin, old_begin + size) to the same offset from new_begin
+		void rebase_owners(const void* old_begin, size_t size, const void* new_begin)
+		{
+			const uint8_t* old_bytes = static_cast<const uint8_t*>(old_begin);
+			for (Watch& existing_watch : watches)
+			{
+				const uint8_t* owner_bytes = static_cast<const uint8_t*>(existing_watch.owner_ptr);
+				if (existing_watch.is_active && owner_bytes >= old_bytes && owner_bytes < old_bytes + size)
+					existing_watch.owner_ptr = static_cast<const uint8_t*>(new_begin) + (owner_bytes - old_bytes);
+			}
+		}
+
+	  private:
+		struct Watch
+		{
+			int fd = -1;
+			uint32_t events = 0;
+			const void* owner_ptr = nullptr;
+			bool is_active = false;
+			bool is_ready = false;
+		};
+
+		void mark_ready(uint32_t watch_id, WakeFn wake_fn, void* context)
+		{
+			Watch& ready_watch = watches[watch_id];
+			if (!ready_watch.is_active || ready_watch.is_ready)
+				return;
+
+			ready_watch.is_ready = true;
+			wake_fn(context, ready_watch.owner_ptr);
+		}
+
+		// platform-specific (see backends/*/IoReactor_*.inl):
+		bool add_to_poll_set(uint32_t watch_id);
+		void remove_from_poll_set(uint32_t watch_id);
+		void close_poll_handle();
+
+		Watch watches[DEFAULT_MAX_IO_WATCHES];
+		uint32_t watch_count = 0;
+		int poll_handle = -1; // epoll instance, where the platform has one
+	};
+
+	inline uint32_t IoReactor::watch(int fd, uint32_t events, const void* owner_ptr)
+	{
+		if (fd < 0 || events == 0)
+			ROBOTICK_FATAL_EXIT("IoReactor::watch() - invalid fd (%d) or no events requested", fd);
+
+		for (uint32_t watch_id = 0; watch_id < DEFAULT_MAX_IO_WATCHES; ++watch_id)
+		{
+			Watch& new_watch = watches[watch_id];
+			if (new_watch.is_active)
+				continue;
+
+			new_watch.fd = fd;
+			new_watch.events = events;
+			new_watch.owner_ptr = owner_ptr;
+			new_watch.is_ready = false;
+
+			if (!add_to_poll_set(watch_id))
+				ROBOTICK_FATAL_EXIT("IoReactor::watch() - unable to watch fd %d", fd);
+
+			new_watch.is_active = true;
+			watch_count++;
+			return watch_id;
+		}
+
+		ROBOTICK_FATAL_EXIT("IoReactor::watch() - cannot watch more than %u fds (see DEFAULT_MAX_IO_WATCHES)", DEFAULT_MAX_IO_WATCHES);
+		return INVALID_WATCH;
+	}
+
+	inline void IoReactor::unwatch(uint32_t watch_id)
+	{
+		if (watch_id >= DEFAULT_MAX_IO_WATCHES || !watches[watch_id].is_active)
+			return;
+
+		remove_from_poll_set(watch_id);
+		watches[watch_id] = Watch{};
+		watch_count--;
+	}
+
+} // namespace robotick
+
+// Platform-specific implementation
+#if defined(ROBOTICK_PLATFORM_ESP32S3)
+#include "robotick/framework/backends/esp32/IoReactor_esp32.inl"
+#elif defined(ROBOTICK_PLATFORM_DESKTOP)
+#include "robotick/framework/backends/desktop/IoReactor_desktop.inl"
+#else
+#error "No IoReactor implementation for this platform – define a platform macro or add a generic fallback"
+#endif
@@ -36,10 +36,12 @@ namespace robotick
 		static void sleep_ms(uint32_t ms);
 		static void hybrid_sleep_until(Clock::time_point target_time);
 
+		// pins the calling thread to a core (threads created with a core pin themselves on start)
+		static void set_affinity(int core);
+
 	  protected:
 		static void set_name(const char* name);
 		static void set_priority_high();
-		static void set_affinity(int core);
 
 	  private:
 #if defined(ROBOTICK_PLATFORM_ESP32S3)
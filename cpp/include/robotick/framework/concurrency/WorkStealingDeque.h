@@ -0,0 +1,98 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/framework/concurrency/Atomic.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	/**
+	 * @brief Bounded Chase-Lev work-stealing deque.
+	 *
+	 * The owning thread pushes and pops at the bottom (LIFO, cache-warm); any other thread may steal from the top (FIFO).
+	 * Storage is fixed at compile time so no allocation ever happens on the tick path - push() simply fails when full and
+	 * the caller is expected to run the item inline instead.
+	 *
+	 * @tparam T Trivially-copyable item type (typically a pointer)
+	 * @tparam Capacity Maximum number of queued items
+	 */
+	template <typename T, size_t Capacity> class WorkStealingDeque
+	{
+		static_assert(Capacity > 0, "WorkStealingDeque capacity must be non-zero");
+
+	  public:
+		/// @brief Owner-only: returns false (without queuing) when the deque is full
+		bool push(T item)
+		{
+			const int64_t b = bottom.load(std_approved::memory_order_relaxed);
+			const int64_t t = top.load(std_approved::memory_order_acquire);
+			if (b - t >= static_cast<int64_t>(Capacity))
+				return false;
+
+			slots[static_cast<size_t>(b) % Capacity].store(item, std_approved::memory_order_relaxed);
+			thread_fence_release();
+			bottom.store(b + 1, std_approved::memory_order_relaxed);
+			return true;
+		}
+
+		/// @brief Owner-only: takes the most recently pushed item
+		bool pop(T& out_item)
+		{
+			const int64_t b = bottom.load(std_approved::memory_order_relaxed) - 1;
+			bottom.store(b, std_approved::memory_order_relaxed);
+			thread_fence(std_approved::memory_order_seq_cst);
+			int64_t t = top.load(std_approved::memory_order_relaxed);
+
+			if (t > b)
+			{
+				// empty - restore bottom
+				bottom.store(b + 1, std_approved::memory_order_relaxed);
+				return false;
+			}
+
+			out_item = slots[static_cast<size_t>(b) % Capacity].load(std_approved::memory_order_relaxed);
+			if (t != b)
+				return true; // more than one item left, no race with thieves possible
+
+			// last item - race any thieves for it:
+			const bool won = top.compare_exchange_strong(t, t + 1, std_approved::memory_order_seq_cst, std_approved::memory_order_relaxed);
+			bottom.store(b + 1, std_approved::memory_order_relaxed);
+			return won;
+		}
+
+		/// @brief Any thread: takes the oldest item; returns false if empty or if another thread won the race for it
+		bool steal(T& out_item)
+		{
+			int64_t t = top.load(std_approved::memory_order_acquire);
+			thread_fence(std_approved::memory_order_seq_cst);
+			const int64_t b = bottom.load(std_approved::memory_order_acquire);
+
+			if (t >= b)
+				return false;
+
+			out_item = slots[static_cast<size_t>(t) % Capacity].load(std_approved::memory_order_relaxed);
+			return top.compare_exchange_strong(t, t + 1, std_approved::memory_order_seq_cst, std_approved::memory_order_relaxed);
+		}
+
+		/// @brief Approximate when called from a non-owning thread
+		bool is_empty() const
+		{
+			const int64_t b = bottom.load(std_approved::memory_order_relaxed);
+			const int64_t t = top.load(std_approved::memory_order_relaxed);
+			return b <= t;
+		}
+
+		static constexpr size_t capacity() { return Capacity; }
+
+	  private:
+		// keep the thieves' end and the owner's end on separate cache lines:
+		alignas(64) AtomicValue<int64_t> top{0};
+		alignas(64) AtomicValue<int64_t> bottom{0};
+		AtomicValue<T> slots[Capacity];
+	};
+
+} // namespace robotick
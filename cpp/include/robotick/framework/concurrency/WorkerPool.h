@@ -0,0 +1,77 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	struct WorkerTask
+	{
+		void (*fn)(void* context, uint32_t index) = nullptr;
+		void* context = nullptr;
+		uint32_t index = 0;
+
+	  private:
+		friend class WorkerPool;
+		AtomicValue<uint32_t>* pending_count = nullptr; // barrier of the run_and_wait() call this task was last submitted from
+	};
+
+	/**
+	 * @brief Engine-owned pool of worker threads with per-thread work-stealing queues.
+	 *
+	 * run_and_wait() pushes a batch of tasks onto the calling thread's queue, wakes any parked workers, and then helps execute
+	 * tasks until the whole batch has completed - so it doubles as an end-of-batch barrier. Idle workers steal from other
+	 * queues (including the submitter's), and tasks may themselves call run_and_wait() to fan out further (e.g. nested groups).
+	 *
+	 * Nothing is allocated per batch: tasks are owned by the caller and must stay alive until run_and_wait() returns.
+	 * Only one non-worker thread (normally the Engine's tick thread) may submit at any one time.
+	 */
+	class WorkerPool
+	{
+	  public:
+		WorkerPool() = default;
+		~WorkerPool();
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		void start(uint32_t worker_thread_count);
+		void stop();
+
+		bool is_running() const { return workers != nullptr; }
+		uint32_t get_worker_thread_count() const { return worker_thread_count; }
+
+		/// @brief Runs every task (in any order, on any worker or the calling thread) and returns once all have completed
+		void run_and_wait(WorkerTask* const* tasks, size_t task_count);
+
+	  private:
+		struct Worker;
+
+		static void worker_thread_entry(void* arg);
+
+		void worker_loop(uint32_t queue_index);
+		bool find_task(uint32_t queue_index, WorkerTask*& out_task);
+		void execute_task(WorkerTask& task);
+		void wake_parked_workers();
+
+		Worker* workers = nullptr;		  // [0] is reserved for the external submitting thread, [1..N] are worker threads
+		uint32_t worker_thread_count = 0; // excludes the external submitter's queue
+
+		AtomicFlag stopping;
+		AtomicFlag external_queue_in_use;
+		AtomicValue<uint32_t> work_epoch{0};
+		AtomicValue<uint32_t> parked_workers{0};
+		AtomicValue<uint32_t> exited_workers{0};
+
+		Mutex park_mutex;
+		ConditionVariable park_condition;
+	};
+
+} // namespace robotick
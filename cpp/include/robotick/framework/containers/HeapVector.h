@@ -4,6 +4,7 @@
 #pragma once
 
 #include "robotick/api_base.h"
+#include "robotick/framework/memory/ArenaOrHeap.h"
 
 #include <cstddef>
 #include <new>
@@ -24,6 +25,7 @@ namespace robotick
 	///
 	/// @note Attempting to reinitialize, reassign, or resize will cause a fatal exit.
 	///       Destruction calls all element destructors and frees memory.
+	///       Initialized while an Engine loads, its memory comes from that engine's MemoryArena (if enabled).
 
 	template <typename T> class HeapVector
 	{
@@ -51,7 +53,7 @@ namespace robotick
 		{
 			if (other.size_ == 0)
 				return;
-			data_ = static_cast<T*>(operator new[](other.size_ * sizeof(T)));
+			data_ = static_cast<T*>(allocate_arena_or_heap(other.size_ * sizeof(T), alignof(T), arena_));
 			size_t constructed = 0;
 			try
 			{
@@ -67,7 +69,7 @@ namespace robotick
 				{
 					data_[i].~T();
 				}
-				operator delete[](data_);
+				release_arena_or_heap(data_, alignof(T), arena_);
 				data_ = nullptr;
 				throw;
 			}
@@ -82,7 +84,7 @@ namespace robotick
 			}
 			if (other.size_ == 0)
 				return *this;
-			data_ = static_cast<T*>(operator new[](other.size_ * sizeof(T)));
+			data_ = static_cast<T*>(allocate_arena_or_heap(other.size_ * sizeof(T), alignof(T), arena_));
 			size_t constructed = 0;
 			try
 			{
@@ -98,7 +100,7 @@ namespace robotick
 				{
 					data_[i].~T();
 				}
-				operator delete[](data_);
+				release_arena_or_heap(data_, alignof(T), arena_);
 				data_ = nullptr;
 				throw;
 			}
@@ -110,8 +112,10 @@ namespace robotick
 		{
 			data_ = other.data_;
 			size_ = other.size_;
+			arena_ = other.arena_;
 			other.data_ = nullptr;
 			other.size_ = 0;
+			other.arena_ = nullptr;
 		}
 
 		// Move assignment
@@ -123,8 +127,10 @@ namespace robotick
 			}
 			data_ = other.data_;
 			size_ = other.size_;
+			arena_ = other.arena_;
 			other.data_ = nullptr;
 			other.size_ = 0;
+			other.arena_ = nullptr;
 			return *this;
 		}
 
@@ -134,7 +140,7 @@ namespace robotick
 			{
 				ROBOTICK_FATAL_EXIT("HeapVector::initialize() called more than once");
 			}
-			data_ = static_cast<T*>(operator new[](count * sizeof(T)));
+			data_ = static_cast<T*>(allocate_arena_or_heap(count * sizeof(T), alignof(T), arena_));
 			for (size_t i = 0; i < count; ++i)
 			{
 				new (&data_[i]) T();
@@ -174,13 +180,15 @@ namespace robotick
 				{
 					data_[i].~T();
 				}
-				operator delete[](data_);
+				release_arena_or_heap(data_, alignof(T), arena_);
 			}
 			data_ = nullptr;
 			size_ = 0;
+			arena_ = nullptr;
 		}
 
 		T* data_ = nullptr;
 		size_t size_ = 0;
+		MemoryArena* arena_ = nullptr; // where data_ came from (nullptr: the heap - see MemoryArena)
 	};
 } // namespace robotick
@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include "robotick/api_base.h"
+#include "robotick/framework/memory/ArenaOrHeap.h"
+
 #include <cstddef>
+#include <new>
 
 namespace robotick
 {
@@ -19,8 +23,8 @@ namespace robotick
 	 *   list.push_back(Foo{...});
 	 *   for (Foo& item : list) { ... }
 	 *
-	 * This container is designed to be friendly to Robotick’s memory model. While it uses heap allocation, each node is
-	 * individually controlled and visible, making it compatible with the custom `MemoryManager` if needed.
+	 * This container is designed to be friendly to Robotick’s memory model. Nodes are allocated individually - from the heap, or
+	 * from the engine's MemoryArena for those pushed while it loads (if enabled), so they then sit together.
 	 *
 	 * @tparam T The value type to store. Must be movable or copyable.
 	 */
@@ -31,6 +35,7 @@ namespace robotick
 		{
 			T value;
 			Node* next = nullptr;
+			MemoryArena* arena = nullptr; // where this node came from (nullptr: the heap) - so freeing it needn't search for it
 		};
 
 		class Iterator
@@ -59,7 +64,9 @@ namespace robotick
 
 		T& push_back()
 		{
-			Node* node = new Node;
+			MemoryArena* arena = nullptr;
+			Node* node = new (allocate_node(arena)) Node;
+			node->arena = arena;
 			if (tail)
 			{
 				tail->next = node;
@@ -76,7 +83,9 @@ namespace robotick
 
 		T& push_back(const T& value)
 		{
-			Node* node = new Node{value, nullptr};
+			MemoryArena* arena = nullptr;
+			Node* node = new (allocate_node(arena)) Node{value, nullptr};
+			node->arena = arena;
 			if (tail)
 			{
 				tail->next = node;
@@ -93,7 +102,9 @@ namespace robotick
 
 		T& push_back(T&& value)
 		{
-			Node* node = new Node{static_cast<T&&>(value), nullptr};
+			MemoryArena* arena = nullptr;
+			Node* node = new (allocate_node(arena)) Node{static_cast<T&&>(value), nullptr};
+			node->arena = arena;
 			if (tail)
 			{
 				tail->next = node;
@@ -120,7 +131,9 @@ namespace robotick
 			while (node)
 			{
 				Node* next = node->next;
-				delete node;
+				MemoryArena* arena = node->arena;
+				node->~Node();
+				release_arena_or_heap(node, alignof(Node), arena);
 				node = next;
 			}
 			head = nullptr;
@@ -133,6 +146,8 @@ namespace robotick
 		size_t size() const { return list_size; }
 
 	  private:
+		static void* allocate_node(MemoryArena*& out_arena) { return allocate_arena_or_heap(sizeof(Node), alignof(Node), out_arena); }
+
 		Node* head = nullptr;
 		Node* tail = nullptr;
 		size_t list_size = 0;
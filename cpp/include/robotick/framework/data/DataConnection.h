@@ -54,6 +54,18 @@ namespace robotick
 
 			::memcpy(dest_ptr, source_ptr, size);
 		}
+
+		// As do_data_copy(), but compares first - returning whether the destination actually changed (for event-driven consumers)
+		bool do_data_copy_if_changed() const noexcept
+		{
+			ROBOTICK_ASSERT(source_ptr != nullptr && dest_ptr != nullptr && size > 0);
+
+			if (::memcmp(dest_ptr, source_ptr, size) == 0)
+				return false;
+
+			::memcpy(dest_ptr, source_ptr, size);
+			return true;
+		}
 	};
 
 	struct FieldInfo
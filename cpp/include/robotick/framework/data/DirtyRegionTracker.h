@@ -0,0 +1,118 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/containers/HeapVector.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	class RawBuffer;
+
+	/**
+	 * @brief Which cache lines (DEFAULT_CACHE_LINE_BYTES) of a WorkloadsBuffer the current frame has written.
+	 *
+	 * The Engine clears it as each frame begins, then marks what the frame writes: the destinations of data-connections whose
+	 * values changed, telemetry and remote input writes, and the outputs (plus their blackboard storage) and stats of every
+	 * workload that ticked - and the whole of every workload under one that ticks its own children (with a self-ticking root,
+	 * the whole tree). Members a workload keeps outside its outputs are not otherwise tracked, and nor is anything written at load.
+	 *
+	 * Consumers then copy only the dirty lines - e.g. RawBuffer::update_mirror_from(source, dirty_regions) - and those syncing
+	 * less often than every frame OR each frame's lines into a bitmap of their own with accumulate_into().
+	 *
+	 * Marking is one fetch_or per word of 64 lines, so workloads ticking on other threads can mark alongside the tick thread.
+	 * Everything else (clear(), and reading the marks) is for the tick thread, between frames.
+	 */
+	class DirtyRegionTracker
+	{
+	  public:
+		static constexpr size_t LINE_BYTES = DEFAULT_CACHE_LINE_BYTES;
+
+		// Tracks the first size bytes of the buffer (the used part, once the Engine's layout is final).
+		void initialize(const RawBuffer& buffer, size_t size);
+		bool is_initialized() const { return words.size() > 0; }
+
+		// No-ops if not initialized, so writers can mark unconditionally. Anything outside the tracked bytes is ignored.
+		void mark_dirty(const void* ptr, size_t size);
+		void mark_dirty_range(size_t offset, size_t size);
+
+		void clear();
+
+		bool is_dirty(size_t offset) const;
+		size_t get_dirty_line_count() const;
+		size_t get_tracked_size() const { return tracked_size; }
+		size_t get_word_count() const { return words.size(); }
+
+		// ORs this frame's dirty lines into accumulated_words (which must have get_word_count() words)
+		void accumulate_into(HeapVector<uint64_t>& accumulated_words) const;
+
+		// Calls range_fn(offset, size) for each run of consecutive dirty lines (clamped to the tracked bytes).
+		template <typename RangeFn> void for_each_dirty_range(RangeFn range_fn) const
+		{
+			for_each_range_in_words([this](size_t word_index) { return words[word_index].load(std_approved::memory_order_relaxed); },
+				words.size(),
+				tracked_size,
+				range_fn);
+		}
+
+		// As for_each_dirty_range(), over a bitmap built up with accumulate_into()
+		template <typename RangeFn> static void for_each_range(const HeapVector<uint64_t>& line_words, size_t tracked_size, RangeFn range_fn)
+		{
+			for_each_range_in_words([&line_words](size_t word_index) { return line_words[word_index]; }, line_words.size(), tracked_size, range_fn);
+		}
+
+	  private:
+		template <typename WordFn, typename RangeFn>
+		static void for_each_range_in_words(WordFn word_fn, size_t word_count, size_t tracked_size, RangeFn range_fn)
+		{
+			size_t run_begin_line = 0;
+			size_t run_line_count = 0;
+
+			auto flush_run = [&]()
+			{
+				if (run_line_count == 0)
+					return;
+
+				const size_t offset = run_begin_line * LINE_BYTES;
+				const size_t end = (run_begin_line + run_line_count) * LINE_BYTES;
+				range_fn(offset, (end < tracked_size ? end : tracked_size) - offset);
+				run_line_count = 0;
+			};
+
+			for (size_t word_index = 0; word_index < word_count; ++word_index)
+			{
+				const uint64_t word = word_fn(word_index);
+				if (word == 0)
+				{
+					flush_run();
+					continue;
+				}
+
+				for (size_t bit = 0; bit < 64; ++bit)
+				{
+					const size_t line = word_index * 64 + bit;
+					if ((word & (1ull << bit)) == 0)
+					{
+						flush_run();
+					}
+					else if (run_line_count++ == 0)
+					{
+						run_begin_line = line;
+					}
+				}
+			}
+
+			flush_run();
+		}
+
+		const uint8_t* buffer_begin = nullptr;
+		size_t tracked_size = 0;
+		HeapVector<AtomicValue<uint64_t>> words; // one bit per line
+	};
+
+} // namespace robotick
@@ -63,6 +63,7 @@ namespace robotick
 		};
 
 		using BinderCallback = Function<bool(const char* path, Field& out_field)>;
+		using FieldReceivedCallback = Function<void(const Field& field)>;
 
 		RemoteEngineConnection() = default;
 		~RemoteEngineConnection() noexcept { disconnect(); }
@@ -75,10 +76,19 @@ namespace robotick
 		void configure_sender(const char* in_my_model_name, const char* in_target_model_name, const char* in_remote_ip, uint16_t in_remote_port);
 		void configure_receiver(const char* my_model_name);
 
-		void tick(const TickInfo& tick_info);
+		// tick_receive() runs before the engine's tick (connecting, handshaking, taking in fields and requests), and tick_send()
+		// after it - so a sender's fields go out in the same tick that wrote them, rather than at the start of the next.
+		void tick(const TickInfo& tick_info)
+		{
+			tick_receive(tick_info);
+			tick_send();
+		}
+		void tick_receive(const TickInfo& tick_info);
+		void tick_send();
 
 		void register_field(const Field& field);	  // for Sender
 		void set_field_binder(BinderCallback binder); // for Receiver
+		void set_field_received_callback(FieldReceivedCallback callback); // for Receiver - called as each field's data completes
 
 		void disconnect();
 
@@ -123,6 +133,7 @@ namespace robotick
 		uint16_t listen_port = 0; // ask OS for ephemeral port first time; reuse assigned port thereafter
 
 		BinderCallback binder;
+		FieldReceivedCallback field_received_callback;
 
 		// set on startup (register_field()) on Sender; on tick_receiver_receive_handshake_and_bind() on Receiver:
 		HeapVector<Field> fields;
@@ -138,6 +149,7 @@ namespace robotick
 
 		float mutual_tick_rate_hz = 0.0f; // gets set to minimum of receiver and sender engine's root tick-rate, on handshake
 		uint64_t ticks_until_next_send = 1;
+		bool is_fields_request_pending = false; // a FieldsRequest arrived in tick_receive(), for tick_send() to answer
 
 		// Each half of the TCP stream gets its own InProgressMessage so a long-running send never blocks an incoming reader.
 		// This lets the tick loop pump READY + FIELD packets back-to-back without reentrancy hazards.
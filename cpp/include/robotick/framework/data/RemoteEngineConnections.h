@@ -29,7 +29,12 @@ namespace robotick
 
 		void setup(Engine& engine, const Model& model);
 		void stop();
-		void tick(const TickInfo& tick_info);
+
+		// Before the engine's tick: discovery, connection upkeep, and taking in remote fields (see RemoteEngineConnection).
+		void tick_receive(const TickInfo& tick_info);
+
+		// After the engine's tick: sends the outputs it just wrote to remote engines, without waiting for the next tick.
+		void tick_send();
 
 	  private:
 		Engine* engine = nullptr;
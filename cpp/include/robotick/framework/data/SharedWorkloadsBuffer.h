@@ -0,0 +1,105 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/strings/FixedString.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	/**
+	 * @brief Start of a WorkloadsBuffer's shared-memory segment (see WorkloadsBufferAllocation::SharedMemory).
+	 *
+	 * Lets loggers, visualisers and monitors in other processes on the same machine read the engine's frames in place - no copies
+	 * and no HTTP - via SharedWorkloadsBufferReader. The buffer itself follows at buffer_offset, and its layout (the same JSON
+	 * that TelemetryServer serves) is published in a second segment, named "<name>.layout", once the engine has loaded.
+	 */
+	struct SharedWorkloadsBufferHeader
+	{
+		static constexpr uint32_t MAGIC = 0x4B574252u; // "RBWK"
+		static constexpr uint32_t VERSION = 2;
+
+		AtomicValue<uint32_t> magic{0}; // written last, once the rest is valid
+		uint32_t version = 0;
+		int64_t owner_process_id = 0; // the engine's process - once it has gone, a segment left behind is stale (see create())
+		uint64_t buffer_offset = 0; // from the start of the segment
+		uint64_t buffer_size = 0;
+		AtomicValue<uint64_t> buffer_size_used{0};
+		AtomicValue<uint32_t> frame_seq{0};	  // the WorkloadsBuffer's telemetry seqlock: odd while a frame is being written
+		AtomicValue<uint32_t> layout_size{0}; // bytes of layout JSON in the layout segment, once published (0 = not yet)
+	};
+
+	// The engine's side: owns the segment (and its layout segment), removing both when released.
+	class SharedWorkloadsSegment
+	{
+	  public:
+		SharedWorkloadsSegment() = default;
+		~SharedWorkloadsSegment() { release(); }
+
+		SharedWorkloadsSegment(SharedWorkloadsSegment&& other) noexcept;
+		SharedWorkloadsSegment& operator=(SharedWorkloadsSegment&& other) noexcept;
+
+		SharedWorkloadsSegment(const SharedWorkloadsSegment&) = delete;
+		SharedWorkloadsSegment& operator=(const SharedWorkloadsSegment&) = delete;
+
+		// Returns false where shared memory is unavailable. The buffer is zeroed, and cache-line aligned. A segment of that name
+		// left behind by an engine whose process has gone is replaced - but one that isn't provably stale (its owner still runs,
+		// or it isn't a segment of ours at all) is fatal, rather than pulled from under whoever has it.
+		bool create(const char* name, size_t buffer_size);
+		void release();
+
+		bool is_created() const { return header != nullptr; }
+		SharedWorkloadsBufferHeader* get_header() const { return header; }
+		uint8_t* get_buffer() const;
+
+		bool publish_layout(const char* layout_json, size_t layout_json_size);
+
+	  private:
+		FixedString128 name;
+		SharedWorkloadsBufferHeader* header = nullptr;
+		size_t mapped_size = 0;
+		void* layout = nullptr;
+		size_t layout_mapped_size = 0;
+	};
+
+	// A reading process's side: maps the segment read-only, and reads frames from it under the seqlock.
+	class SharedWorkloadsBufferReader
+	{
+	  public:
+		SharedWorkloadsBufferReader() = default;
+		~SharedWorkloadsBufferReader() { detach(); }
+
+		SharedWorkloadsBufferReader(const SharedWorkloadsBufferReader&) = delete;
+		SharedWorkloadsBufferReader& operator=(const SharedWorkloadsBufferReader&) = delete;
+
+		// Returns false if there is no (fully created) segment of that name, or it is from an incompatible version.
+		bool attach(const char* name);
+		void detach();
+
+		bool is_attached() const { return header != nullptr; }
+		const SharedWorkloadsBufferHeader* get_header() const { return header; }
+		const uint8_t* get_buffer() const;
+		size_t get_buffer_size_used() const;
+
+		// The layout JSON (null-terminated), or nullptr until the engine has published it
+		const char* get_layout_json();
+
+		// Seqlock reads: begin_read() returns false while a frame is being written, otherwise giving the frame_seq to pass to
+		// end_read() - which says whether everything read in between came from that one frame (if not, read it again).
+		bool begin_read(uint32_t& out_frame_seq) const;
+		bool end_read(uint32_t frame_seq) const;
+
+	  private:
+		FixedString128 name;
+		const SharedWorkloadsBufferHeader* header = nullptr;
+		size_t mapped_size = 0;
+		const void* layout = nullptr;
+		size_t layout_mapped_size = 0;
+	};
+
+} // namespace robotick
@@ -7,6 +7,7 @@
 #include <new>
 
 #include "robotick/framework/memory/Memory.h"
+#include "robotick/framework/memory/ArenaOrHeap.h"
 #include "robotick/framework/utility/TypeTraits.h"
 
 namespace robotick
@@ -60,7 +61,7 @@ namespace robotick
 	};
 
 	//---------------------------------------------------------------------------------------------------
-	// StatePtr<T> - pointer-based alternative for large states (allocated on heap once on startup)
+	// StatePtr<T> - pointer-based alternative for large states (allocated once on startup - from the engine's MemoryArena if any)
 	//---------------------------------------------------------------------------------------------------
 	template <typename T, bool EnforceLargeState = true> class StatePtr
 	{
@@ -73,7 +74,7 @@ namespace robotick
 
 	  public:
 		StatePtr()
-			: ptr(new T())
+			: ptr(new (allocate_arena_or_heap(sizeof(T), alignof(T), arena)) T())
 		{
 		}
 		~StatePtr() { destroy(); }
@@ -83,8 +84,10 @@ namespace robotick
 		{
 			if (ptr)
 			{
-				delete ptr;
+				ptr->~T();
+				release_arena_or_heap(ptr, alignof(T), arena);
 				ptr = nullptr;
+				arena = nullptr;
 			}
 		}
 
@@ -92,18 +95,22 @@ namespace robotick
 		StatePtr& operator=(const StatePtr&) = delete;
 
 		StatePtr(StatePtr&& other) noexcept
-			: ptr(other.ptr)
+			: arena(other.arena)
+			, ptr(other.ptr)
 		{
 			other.ptr = nullptr;
+			other.arena = nullptr;
 		}
 
 		StatePtr& operator=(StatePtr&& other) noexcept
 		{
 			if (this != &other)
 			{
-				delete ptr;
+				destroy();
 				ptr = other.ptr;
+				arena = other.arena;
 				other.ptr = nullptr;
+				other.arena = nullptr;
 			}
 			return *this;
 		}
@@ -118,6 +125,7 @@ namespace robotick
 		const T& get() const { return *ptr; }
 
 	  private:
+		MemoryArena* arena = nullptr; // where ptr came from (nullptr: the heap) - declared first, as the constructor sets it
 		T* ptr = nullptr;
 	};
 
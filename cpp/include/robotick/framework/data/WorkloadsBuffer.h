@@ -5,13 +5,16 @@
 
 #include "robotick/api_base.h"
 #include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/data/SharedWorkloadsBuffer.h"
 #include "robotick/framework/memory/Memory.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
 
 #include <cstddef>
 #include <cstdint>
 
 namespace robotick
 {
+	class DirtyRegionTracker;
 
 	class RawBuffer
 	{
@@ -19,7 +22,9 @@ namespace robotick
 		RawBuffer() = default;
 		RawBuffer(RawBuffer&&) noexcept = default;
 
-		explicit RawBuffer(size_t size);
+		// shared_memory_name names the segment for WorkloadsBufferAllocation::SharedMemory (e.g. "/robotick_arm")
+		explicit RawBuffer(
+			size_t size, WorkloadsBufferAllocation allocation = WorkloadsBufferAllocation::Heap, const char* shared_memory_name = nullptr);
 
 		RawBuffer(const RawBuffer&) = delete;
 		RawBuffer& operator=(const RawBuffer&) = delete;
@@ -30,6 +35,14 @@ namespace robotick
 		const uint8_t* raw_ptr() const;
 		size_t get_size() const;
 
+		// whether the memory came from WorkloadsBufferAllocation::LockedPages (rather than falling back to the heap), and was locked
+		bool is_mapped() const { return data.is_mapped; }
+		bool is_locked() const { return data.is_locked; }
+
+		// whether the memory came from WorkloadsBufferAllocation::SharedMemory - and, if so, publishes its layout JSON to readers
+		bool is_shared() const { return data.shared_segment.is_created(); }
+		bool publish_shared_layout(const char* layout_json, size_t layout_json_size);
+
 		bool contains_object(const uint8_t* query_ptr, const size_t query_size) const;
 
 		bool contains_object(const void* query_ptr, const size_t query_size) const;
@@ -38,6 +51,9 @@ namespace robotick
 
 		void update_mirror_from(const RawBuffer& source);
 
+		// As update_mirror_from(source), but copying only the lines dirty_regions has marked (for a mirror synced every frame)
+		void update_mirror_from(const RawBuffer& source, const DirtyRegionTracker& dirty_regions);
+
 		template <typename T> T* as(size_t offset = 0)
 		{
 			if (offset + sizeof(T) > size)
@@ -62,6 +78,9 @@ namespace robotick
 			return robotick::launder(reinterpret_cast<const T*>(ptr));
 		}
 
+	  protected:
+		SharedWorkloadsBufferHeader* get_shared_header() const { return data.shared_segment.get_header(); }
+
 	  private:
 		size_t size = 0;
 
@@ -82,16 +101,21 @@ namespace robotick
 
 			bool is_allocated() const;
 
-			void allocate(size_t alloc_size);
+			void allocate(size_t alloc_size, WorkloadsBufferAllocation allocation, const char* shared_memory_name);
 			void release();
 
 			uint8_t* ptr = nullptr;
 			size_t size = 0;
+			size_t mapped_size = 0; // whole pages, if is_mapped
+			bool is_mapped = false;
+			bool is_locked = false;
+			SharedWorkloadsSegment shared_segment; // holds the memory, if created
 		};
 
 		AlignedStorage data;
 
-		void allocate_aligned(size_t alloc_size);
+		void allocate_aligned(
+			size_t alloc_size, WorkloadsBufferAllocation allocation = WorkloadsBufferAllocation::Heap, const char* shared_memory_name = nullptr);
 	};
 
 	class WorkloadsBuffer : public RawBuffer
@@ -119,12 +143,12 @@ namespace robotick
 			uint32_t seq = telemetry_frame_seq.load();
 			if ((seq & 1u) == 0u)
 			{
-				telemetry_frame_seq.store(seq + 1u);
+				store_frame_seq(seq + 1u);
 				return;
 			}
 
 			// Already odd (unexpected but safe): move to next odd value.
-			telemetry_frame_seq.store(seq + 2u);
+			store_frame_seq(seq + 2u);
 		}
 
 		inline void mark_frame_write_end()
@@ -132,17 +156,30 @@ namespace robotick
 			uint32_t seq = telemetry_frame_seq.load();
 			if ((seq & 1u) != 0u)
 			{
-				telemetry_frame_seq.store(seq + 1u);
+				store_frame_seq(seq + 1u);
 				return;
 			}
 
 			// Already even (unexpected but safe): move to next even value.
-			telemetry_frame_seq.store(seq + 2u);
+			store_frame_seq(seq + 2u);
 		}
 
 		inline uint32_t get_telemetry_frame_seq() const { return telemetry_frame_seq.load(); }
 
 	  private:
+		// also exposed in the shared header, if any - for out-of-process readers (see SharedWorkloadsBufferReader)
+		inline void store_frame_seq(uint32_t seq)
+		{
+			telemetry_frame_seq.store(seq);
+
+			SharedWorkloadsBufferHeader* shared_header = get_shared_header();
+			if (shared_header != nullptr)
+			{
+				shared_header->frame_seq.store(seq);
+				thread_fence_release(); // (an odd seq must be visible before any of the frame's writes)
+			}
+		}
+
 		size_t size_used = 0;
 		AtomicValue<uint32_t> telemetry_frame_seq{0};
 	};
@@ -0,0 +1,116 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	/**
+	 * @brief Engine-published copies of the WorkloadsBuffer, so other threads can read whole frames without racing the tick.
+	 *
+	 * After each frame the engine copies the used part of its buffer into a free slot and publishes that as the latest. A reader
+	 * pins the latest slot (as a Lease) for as long as it likes - the tick never writes a pinned slot. There are reader_count + 2
+	 * slots, so while at most reader_count leases are held at once there is always one free; beyond that the frame simply isn't
+	 * published (see get_skipped_publish_count()) - a slow reader never stalls the tick.
+	 *
+	 * Given a DirtyRegionTracker (the Engine passes one only if the model opts in - see Model::set_snapshot_dirty_copy_enabled),
+	 * each slot accumulates the lines written since it was last filled, and only those are copied.
+	 *
+	 * acquire() never waits on the tick. It only retries if the tick claims the slot it picked between it loading and pinning it,
+	 * which takes a fresh publish per retry - unlike a seqlock reader, which retries for as long as its copy overlaps any tick.
+	 */
+	class DirtyRegionTracker;
+
+	class WorkloadsBufferSnapshots
+	{
+	  public:
+		class Lease
+		{
+		  public:
+			Lease() = default;
+			~Lease() { release(); }
+
+			Lease(Lease&& other) noexcept
+				: snapshots(other.snapshots)
+				, slot_index(other.slot_index)
+			{
+				other.snapshots = nullptr;
+			}
+
+			Lease& operator=(Lease&& other) noexcept;
+
+			Lease(const Lease&) = delete;
+			Lease& operator=(const Lease&) = delete;
+
+			bool is_valid() const { return snapshots != nullptr; }
+
+			// the frame's copy of the WorkloadsBuffer's used bytes (offsets match the live buffer), and its telemetry frame sequence
+			const uint8_t* data() const;
+			size_t size() const;
+			uint32_t get_frame_seq() const;
+
+			void release();
+
+		  private:
+			friend class WorkloadsBufferSnapshots;
+
+			Lease(WorkloadsBufferSnapshots& snapshots, uint32_t slot_index)
+				: snapshots(&snapshots)
+				, slot_index(slot_index)
+			{
+			}
+
+			WorkloadsBufferSnapshots* snapshots = nullptr;
+			uint32_t slot_index = 0;
+		};
+
+		WorkloadsBufferSnapshots() = default;
+
+		WorkloadsBufferSnapshots(const WorkloadsBufferSnapshots&) = delete;
+		WorkloadsBufferSnapshots& operator=(const WorkloadsBufferSnapshots&) = delete;
+
+		// Sizes each slot to the source's used bytes, so call it once the source's layout is final (i.e. at the end of load). The
+		// dirty_regions (if any) must be marked with everything written between one publish() and the next.
+		void initialize(const WorkloadsBuffer& source, uint32_t reader_count, const DirtyRegionTracker* dirty_regions = nullptr);
+		bool is_initialized() const { return slots.size() > 0; }
+
+		// Copies the source into a free slot and makes it the latest. Only ever called from one thread (the engine's tick).
+		void publish(const WorkloadsBuffer& source);
+
+		// Pins the latest published frame - an invalid Lease if nothing has been published yet. Any thread.
+		Lease acquire();
+
+		uint64_t get_published_count() const { return published_count.load(); }
+		uint64_t get_skipped_publish_count() const { return skipped_publish_count.load(); }
+
+	  private:
+		static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+		static constexpr uint32_t WRITING_BIT = 1u << 31; // in pin_count, while the tick fills the slot
+
+		struct Slot
+		{
+			RawBuffer buffer;
+			size_t size = 0;
+			uint32_t frame_seq = 0;
+			AtomicValue<uint32_t> pin_count{0};
+			HeapVector<uint64_t> stale_lines; // lines written since the slot was last filled (only with dirty_regions)
+		};
+
+		void copy_into_slot(Slot& slot, const WorkloadsBuffer& source);
+
+		HeapVector<Slot> slots;
+		const DirtyRegionTracker* dirty_regions = nullptr;
+		AtomicValue<uint32_t> latest_slot{NO_SLOT};
+		AtomicValue<uint64_t> published_count{0};
+		AtomicValue<uint64_t> skipped_publish_count{0};
+	};
+
+} // namespace robotick
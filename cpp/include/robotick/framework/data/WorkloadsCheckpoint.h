@@ -0,0 +1,89 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	class Engine;
+
+	/**
+	 * @brief Saves a consistent frame of an engine's WorkloadsBuffer state to disk, and restores it into a freshly loaded engine
+	 * running the same model - so a restarted process resumes where it left off, rather than reconverging its filters and
+	 * integrators from scratch.
+	 *
+	 * Only the plain data in the buffer is saved: every workload's inputs and outputs, the contents of their blackboards, and the
+	 * whole of any workload declaring `static constexpr bool is_checkpointable = true` (see WorkloadTypeHelpers.h). Config (which
+	 * comes from the model), stats, and workload members holding pointers (State<>, Blackboard headers, etc.) are left as the new
+	 * engine loaded them.
+	 *
+	 * Those regions (with each workload's name and type, and each field's name, type, offset and size) make up the layout hash,
+	 * which a checkpoint must match to be restored - so fields swapped for others of the same size don't restore into each other.
+	 * See Engine::save_checkpoint() and Engine::restore_checkpoint(), which capture between frames and write outside them.
+	 */
+	class WorkloadsCheckpoint
+	{
+	  public:
+		static constexpr uint32_t MAGIC = 0x4B435252u; // "RRCK"
+		static constexpr uint32_t VERSION = 2;
+
+		WorkloadsCheckpoint() = default;
+
+		WorkloadsCheckpoint(const WorkloadsCheckpoint&) = delete;
+		WorkloadsCheckpoint& operator=(const WorkloadsCheckpoint&) = delete;
+
+		// Finds the regions to save - once the engine has loaded (its buffer layout is final by then).
+		void initialize(const Engine& engine);
+		bool is_initialized() const { return initialized; }
+
+		uint32_t get_layout_hash() const { return layout_hash; }
+		size_t get_region_count() const { return regions.size(); }
+		size_t get_data_size() const { return data_size; }
+		bool has_data() const { return has_captured_data; }
+
+		// Copy the regions out of, and back into, a buffer - both between frames.
+		void capture(const WorkloadsBuffer& source);
+		void apply(WorkloadsBuffer& target) const;
+
+		// Writes the last capture to path (via a temporary file, renamed into place once complete).
+		bool save(const char* path) const;
+
+		// Reads a checkpoint from path, returning false (and keeping any previous data) if it is missing, damaged, or was saved
+		// from a different layout.
+		bool load(const char* path);
+
+	  private:
+		struct Region
+		{
+			size_t offset = 0;
+			size_t size = 0;
+		};
+
+		struct FileHeader
+		{
+			uint32_t magic = 0;
+			uint32_t version = 0;
+			uint32_t layout_hash = 0;
+			uint32_t data_hash = 0;
+			uint64_t data_size = 0;
+			uint32_t frame_seq = 0;
+			uint32_t reserved = 0;
+		};
+
+		HeapVector<Region> regions;
+		RawBuffer data;
+		size_t data_size = 0;
+		uint32_t layout_hash = 0;
+		uint32_t frame_seq = 0;
+		bool initialized = false;
+		bool has_captured_data = false;
+	};
+
+} // namespace robotick
@@ -0,0 +1,18 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+
+namespace robotick
+{
+	class MemoryArena;
+
+	// Allocates from the current arena (if unsealed) or else the heap, noting which in out_arena - to pass back to
+	// release_arena_or_heap() along with the same alignment, which then frees heap memory and leaves arena memory be.
+	// (Kept apart from MemoryArena.h, so the containers and StatePtr using these don't pull in its mutex.)
+	void* allocate_arena_or_heap(size_t size, size_t alignment, MemoryArena*& out_arena);
+	void release_arena_or_heap(void* ptr, size_t alignment, MemoryArena* arena);
+
+} // namespace robotick
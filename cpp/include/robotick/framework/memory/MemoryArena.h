@@ -0,0 +1,81 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/memory/ArenaOrHeap.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	/**
+	 * @brief A bump allocator: carves allocations out of a few large chunks, and frees them all at once when destroyed.
+	 *
+	 * Each Engine owns one (see Model::set_state_arena_enabled), current on its threads while it loads - so the StatePtr<>s,
+	 * HeapVectors and Lists its workloads (and the engine itself) create then sit together, rather than scattered across the
+	 * heap, and long-running processes stop fragmenting it further. The arena is sealed once loading completes: anything
+	 * allocated afterwards comes from the heap as before.
+	 *
+	 * Freeing memory from an arena does nothing (destructors still run) - it is only reclaimed along with the arena, so nothing
+	 * allocated from it may outlive it. Allocation is thread-safe, for load phases shared across a WorkerPool.
+	 */
+	class MemoryArena
+	{
+	  public:
+		explicit MemoryArena(size_t chunk_size = DEFAULT_ARENA_CHUNK_BYTES);
+		~MemoryArena();
+
+		MemoryArena(const MemoryArena&) = delete;
+		MemoryArena& operator=(const MemoryArena&) = delete;
+
+		// Requests bigger than a chunk get a chunk of their own. Fatal once sealed.
+		void* allocate(size_t size, size_t alignment);
+
+		void seal();
+		bool is_sealed() const { return sealed.is_set(); } // (checked by every thread allocating while the engine loads)
+
+		bool owns(const void* ptr) const;
+
+		size_t get_bytes_used() const { return bytes_used; }
+		size_t get_bytes_reserved() const { return bytes_reserved; }
+		size_t get_chunk_count() const { return chunk_count; }
+
+		// The arena StatePtr, HeapVector and List allocate from on this thread (see ScopedMemoryArena), or nullptr for the heap
+		static MemoryArena* get_current();
+
+	  private:
+		friend class ScopedMemoryArena;
+
+		struct Chunk;
+
+		Chunk* add_chunk(size_t min_payload_size);
+
+		size_t chunk_size = 0;
+		Chunk* chunks = nullptr; // newest first - the one allocations come from
+		size_t bytes_used = 0;
+		size_t bytes_reserved = 0;
+		size_t chunk_count = 0;
+		AtomicFlag sealed;
+		mutable Mutex mutex;
+	};
+
+	// Makes an arena current on this thread for its lifetime (nullptr: the heap), restoring the previous one afterwards.
+	class ScopedMemoryArena
+	{
+	  public:
+		explicit ScopedMemoryArena(MemoryArena* arena);
+		~ScopedMemoryArena();
+
+		ScopedMemoryArena(const ScopedMemoryArena&) = delete;
+		ScopedMemoryArena& operator=(const ScopedMemoryArena&) = delete;
+
+	  private:
+		MemoryArena* previous = nullptr;
+	};
+
+} // namespace robotick
@@ -7,7 +7,11 @@
 #include "robotick/framework/containers/ArrayView.h"
 #include "robotick/framework/model/DataConnectionSeed.h"
 #include "robotick/framework/model/RemoteModelSeed.h"
+#include "robotick/framework/model/WorkloadPlacementSeed.h"
 #include "robotick/framework/model/WorkloadSeed.h"
+#include "robotick/framework/model/WorkloadEnableSeed.h"
+#include "robotick/framework/model/WorkloadWatchdogSeed.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
 #include "robotick/framework/strings/StringView.h"
 
 #include <cstdint>
@@ -35,10 +39,72 @@ namespace robotick
 		}
 		void use_remote_models(const RemoteModelSeed* const* in_remote_model_seeds, size_t num_remote_model_seeds);
 
+		// core pins, dedicated threads and NUMA-node hints for named subtrees (see WorkloadPlacementSeed)
+		template <size_t N> void use_workload_placements(const WorkloadPlacementSeed* const (&in_placements)[N])
+		{
+			use_workload_placements(in_placements, N);
+		}
+		void use_workload_placements(const WorkloadPlacementSeed* const* in_placements, size_t num_placements);
+
+		// per-tick budgets policed while ticks are still running, and what to do when one is exceeded (see WorkloadWatchdogSeed)
+		template <size_t N> void use_workload_watchdogs(const WorkloadWatchdogSeed* const (&in_watchdogs)[N])
+		{
+			use_workload_watchdogs(in_watchdogs, N);
+		}
+		void use_workload_watchdogs(const WorkloadWatchdogSeed* const* in_watchdogs, size_t num_watchdogs);
+
+		// bool fields that switch named subtrees on and off from one frame to the next (see WorkloadEnableSeed)
+		template <size_t N> void use_workload_enables(const WorkloadEnableSeed* const (&in_enables)[N])
+		{
+			use_workload_enables(in_enables, N);
+		}
+		void use_workload_enables(const WorkloadEnableSeed* const* in_enables, size_t num_enables);
+
 		void set_root_workload(const WorkloadSeed& root_workload, bool auto_finalize_and_validate = true);
 
 		void set_telemetry_port(const uint16_t in_telemetry_port);
 
+		// number of engine-owned worker threads available to run group children in parallel (0 = tick everything on the tick thread)
+		void set_worker_thread_count(const uint32_t in_worker_thread_count);
+
+		// how children of workloads without a tick_fn are ordered each tick (see TickSchedulingMode)
+		void set_tick_scheduling_mode(const TickSchedulingMode in_tick_scheduling_mode);
+
+		// how the root tick schedule recovers once a tick runs past the start of the next one (see OverrunPolicy)
+		void set_overrun_policy(const OverrunPolicy in_overrun_policy);
+
+		// how the root tick loop waits between ticks (see TickTimerBackend)
+		void set_tick_timer_backend(const TickTimerBackend in_tick_timer_backend);
+
+		// run each workload's construct/pre_load/load/setup across the worker pool, one phase at a time (requires worker threads, and
+		// workloads whose load callbacks don't touch one another)
+		void set_parallel_load_enabled(const bool in_parallel_load_enabled);
+
+		// how workloads and their stats are arranged in the WorkloadsBuffer (see WorkloadsLayout)
+		void set_workloads_layout(const WorkloadsLayout in_workloads_layout);
+
+		// where the WorkloadsBuffer's memory comes from - LockedPages avoids first-touch page faults and TLB misses mid-tick
+		void set_workloads_buffer_allocation(const WorkloadsBufferAllocation in_workloads_buffer_allocation);
+
+		// names the segment (e.g. "/robotick_arm") when allocating the WorkloadsBuffer as WorkloadsBufferAllocation::SharedMemory
+		void set_workloads_buffer_shared_memory_name(const char* in_shared_memory_name);
+
+		// how many threads may each hold a published copy of the WorkloadsBuffer at once (0 = don't publish any; see
+		// WorkloadsBufferSnapshots) - the engine then copies the buffer after every frame
+		void set_snapshot_reader_count(const uint32_t in_snapshot_reader_count);
+
+		// track which parts of the WorkloadsBuffer each frame writes, so its consumers can copy just those (see DirtyRegionTracker)
+		void set_dirty_region_tracking_enabled(const bool in_dirty_region_tracking_enabled);
+
+		// have the published snapshots copy only the lines written since each was last filled, rather than the whole buffer -
+		// which needs dirty-region tracking enabled too. Anything a workload writes outside what the tracker marks (members other
+		// than its outputs, or writes from other threads) then goes stale in the snapshots, so only opt in when that's acceptable.
+		void set_snapshot_dirty_copy_enabled(const bool in_snapshot_dirty_copy_enabled);
+
+		// allocate the StatePtr<>s, HeapVectors and Lists made while loading (by workloads and the engine itself) from one arena the
+		// engine owns, together rather than scattered across the heap - sealed once loaded (see MemoryArena)
+		void set_state_arena_enabled(const bool in_state_arena_enabled);
+
 		// general-purpose finalise function (bakes and validates as needed):
 		void finalize();
 
@@ -48,9 +114,24 @@ namespace robotick
 		const ArrayView<const WorkloadSeed*>& get_workload_seeds() const { return workload_seeds; }
 		const ArrayView<const DataConnectionSeed*>& get_data_connection_seeds() const { return data_connection_seeds; }
 		const ArrayView<const RemoteModelSeed*>& get_remote_models() const { return remote_models; }
+		const ArrayView<const WorkloadPlacementSeed*>& get_workload_placements() const { return workload_placements; }
+		const ArrayView<const WorkloadWatchdogSeed*>& get_workload_watchdogs() const { return workload_watchdogs; }
+		const ArrayView<const WorkloadEnableSeed*>& get_workload_enables() const { return workload_enables; }
 
 		const WorkloadSeed* get_root_workload() const { return root_workload; }
 		uint16_t get_telemetry_port() const { return telemetry_port; };
+		uint32_t get_worker_thread_count() const { return worker_thread_count; };
+		TickSchedulingMode get_tick_scheduling_mode() const { return tick_scheduling_mode; };
+		OverrunPolicy get_overrun_policy() const { return overrun_policy; };
+		TickTimerBackend get_tick_timer_backend() const { return tick_timer_backend; };
+		bool is_parallel_load_enabled() const { return parallel_load_enabled; };
+		WorkloadsLayout get_workloads_layout() const { return workloads_layout; };
+		WorkloadsBufferAllocation get_workloads_buffer_allocation() const { return workloads_buffer_allocation; };
+		const char* get_workloads_buffer_shared_memory_name() const { return workloads_buffer_shared_memory_name.c_str(); };
+		uint32_t get_snapshot_reader_count() const { return snapshot_reader_count; };
+		bool is_dirty_region_tracking_enabled() const { return dirty_region_tracking_enabled; };
+		bool is_snapshot_dirty_copy_enabled() const { return snapshot_dirty_copy_enabled; };
+		bool is_state_arena_enabled() const { return state_arena_enabled; };
 
 	  private:
 		StringView model_name;
@@ -58,10 +139,26 @@ namespace robotick
 		ArrayView<const WorkloadSeed*> workload_seeds;
 		ArrayView<const DataConnectionSeed*> data_connection_seeds;
 		ArrayView<const RemoteModelSeed*> remote_models;
+		ArrayView<const WorkloadPlacementSeed*> workload_placements;
+		ArrayView<const WorkloadWatchdogSeed*> workload_watchdogs;
+		ArrayView<const WorkloadEnableSeed*> workload_enables;
 
 		const WorkloadSeed* root_workload = nullptr;
 
 		uint16_t telemetry_port = 7090;
+
+		uint32_t worker_thread_count = 0;
+		TickSchedulingMode tick_scheduling_mode = TickSchedulingMode::Sequenced;
+		OverrunPolicy overrun_policy = OverrunPolicy::CatchUp;
+		TickTimerBackend tick_timer_backend = TickTimerBackend::Hybrid;
+		bool parallel_load_enabled = false;
+		WorkloadsLayout workloads_layout = WorkloadsLayout::Interleaved;
+		WorkloadsBufferAllocation workloads_buffer_allocation = WorkloadsBufferAllocation::Heap;
+		StringView workloads_buffer_shared_memory_name;
+		uint32_t snapshot_reader_count = 0;
+		bool dirty_region_tracking_enabled = false;
+		bool snapshot_dirty_copy_enabled = false;
+		bool state_arena_enabled = false;
 	};
 
 } // namespace robotick
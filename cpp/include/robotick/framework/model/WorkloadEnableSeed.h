@@ -0,0 +1,28 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/strings/StringView.h"
+
+namespace robotick
+{
+	// Drives whether a workload (and everything beneath it) ticks at all from a bool field elsewhere in the model - e.g. a mode
+	// manager's output, or a blackboard entry - read at the start of every frame. While the field is false the subtree is skipped
+	// without calling any of its tick functions (counted in its skipped_tick_count). Pointing it at an input lets telemetry
+	// toggle the workload too.
+	struct WorkloadEnableSeed
+	{
+		WorkloadEnableSeed() = default;
+
+		WorkloadEnableSeed(const char* workload_name, const char* enable_field_path)
+			: workload_name(workload_name)
+			, enable_field_path(enable_field_path)
+		{
+		}
+
+		StringView workload_name = nullptr;		// unique_name of the workload at the top of the enabled subtree
+		StringView enable_field_path = nullptr; // bool field, as a data-connection path (e.g. "modes.outputs.nav_enabled")
+	};
+} // namespace robotick
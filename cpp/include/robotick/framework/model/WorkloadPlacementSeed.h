@@ -0,0 +1,34 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/strings/StringView.h"
+
+namespace robotick
+{
+	// Where a workload (and everything beneath it) executes, and which NUMA node its memory in the WorkloadsBuffer lives on.
+	//  - on the root: core pins the thread that runs the engine (i.e. calls Engine::run())
+	//  - below the root: the subtree ticks on a dedicated thread (pinned to core, if given), which the parent hands each due
+	//    tick to and waits for before its own tick completes - so siblings run alongside it
+	struct WorkloadPlacementSeed
+	{
+		WorkloadPlacementSeed() = default;
+
+		WorkloadPlacementSeed(const char* workload_name, int core, bool dedicated_thread = false, int numa_node = -1)
+			: workload_name(workload_name)
+			, core(core)
+			, dedicated_thread(dedicated_thread)
+			, numa_node(numa_node)
+		{
+		}
+
+		StringView workload_name = nullptr; // unique_name of the workload at the top of the placed subtree
+		int core = -1;						// CPU core to pin to (-1 = unpinned); below the root this implies a dedicated thread
+		bool dedicated_thread = false;		// tick the subtree on a thread of its own, even without a core pin
+		int numa_node = -1;					// preferred NUMA node for the subtree's workload memory (-1 = leave to the OS)
+
+		bool has_dedicated_thread() const { return dedicated_thread || core >= 0; }
+	};
+} // namespace robotick
@@ -14,6 +14,17 @@
 
 namespace robotick
 {
+	// Number of elements in an instanced workload (a distinct type, so it can't be mistaken for a tick-rate)
+	struct WorkloadInstanceCount
+	{
+		explicit constexpr WorkloadInstanceCount(uint32_t value)
+			: value(value)
+		{
+		}
+
+		uint32_t value = 1;
+	};
+
 	struct WorkloadSeed
 	{
 		WorkloadSeed() = default;
@@ -39,9 +50,27 @@ namespace robotick
 		{
 		}
 
+		// Instanced: instance_count elements of one type, laid out as a contiguous array and ticked together (see tick_batch),
+		// whose fields are addressed as "unique_name[index].outputs.field". Instanced workloads cannot have children.
+		WorkloadSeed(const TypeId& type_id,
+			const StringView& unique_name,
+			WorkloadInstanceCount instance_count,
+			float tick_rate_hz,
+			const ArrayView<const FieldConfigEntry>& config = {},
+			const ArrayView<const FieldConfigEntry>& inputs = {})
+			: type_id(type_id)
+			, unique_name(unique_name)
+			, instance_count(instance_count.value)
+			, tick_rate_hz(tick_rate_hz)
+			, config(config)
+			, inputs(inputs)
+		{
+		}
+
 		// Public data access
 		TypeId type_id;
 		StringView unique_name = nullptr;
+		uint32_t instance_count = 1; // config and inputs seed every element
 
 		float tick_rate_hz = 0.0f;
 
@@ -0,0 +1,30 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
+#include "robotick/framework/strings/StringView.h"
+
+namespace robotick
+{
+	// A time budget for each tick of a workload (including, for a group, its children), policed by the engine's watchdog thread
+	// while the tick is still running - so a hung workload is reported (with a stack sample of the thread running it) before
+	// the whole loop stalls, rather than only counted as an overrun once it finally returns.
+	struct WorkloadWatchdogSeed
+	{
+		WorkloadWatchdogSeed() = default;
+
+		WorkloadWatchdogSeed(const char* workload_name, float budget_ms, WatchdogAction action = WatchdogAction::Log)
+			: workload_name(workload_name)
+			, budget_ms(budget_ms)
+			, action(action)
+		{
+		}
+
+		StringView workload_name = nullptr; // unique_name of the watched workload
+		float budget_ms = 0.0f;				// longest a single tick may run before the watchdog trips
+		WatchdogAction action = WatchdogAction::Log;
+	};
+} // namespace robotick
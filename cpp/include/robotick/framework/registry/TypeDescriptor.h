@@ -5,6 +5,7 @@
 
 #include "robotick/api_base.h"
 
+#include "robotick/framework/concurrency/AsyncTick.h"
 #include "robotick/framework/containers/ArrayView.h"
 #include "robotick/framework/containers/HeapVector.h"
 #include "robotick/framework/strings/StringView.h"
@@ -119,7 +120,19 @@ namespace robotick
 		void (*setup_fn)(void*) = nullptr;
 		void (*start_fn)(void*, float) = nullptr;
 		void (*tick_fn)(void*, const TickInfo&) = nullptr;
+		AsyncTickStatus (*async_tick_fn)(void*, const TickInfo&) = nullptr; // set (alongside tick_fn) when tick() returns AsyncTickStatus
+		void (*tick_batch_fn)(void*, size_t, const TickInfo&) = nullptr;	  // ticks every element of an instanced workload in one call
+		bool (*has_work_fn)(const void*) = nullptr; // asked before each due tick - false skips it (and, for a group, its subtree)
 		void (*stop_fn)(void*) = nullptr;
+
+		// scheduling
+		bool is_event_driven = false; // only ticked when a connection, remote field or telemetry write has delivered new inputs
+
+		// persistence
+		bool is_checkpointable = false; // all plain data - checkpoints save the whole workload (see WorkloadsCheckpoint)
+
+		// loading
+		bool is_relocatable = false; // may be moved byte-for-byte once pre-loaded, as models with blackboards need (see is_relocatable_workload)
 	};
 
 	enum class TypeCategory
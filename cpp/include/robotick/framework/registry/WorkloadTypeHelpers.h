@@ -67,6 +67,23 @@ namespace robotick::registry
 	{
 	};
 
+	// static void tick_batch(const TickInfo&, ArrayView<T> instances) - used for instanced workloads (see WorkloadSeed::instance_count)
+	template <typename T, typename = void> struct has_tick_batch : FalseType<>
+	{
+	};
+	template <typename T>
+	struct has_tick_batch<T, void_t<decltype(T::tick_batch(declval<const TickInfo&>(), declval<ArrayView<T>>()))>> : TrueType<>
+	{
+	};
+
+	// bool has_work() const - asked (after its inputs are copied) before each due tick; false skips the tick as idle
+	template <typename T, typename = void> struct has_has_work : FalseType<>
+	{
+	};
+	template <typename T> struct has_has_work<T, void_t<decltype(declval<const T>().has_work())>> : TrueType<>
+	{
+	};
+
 	template <typename T, typename = void> struct has_stop : FalseType<>
 	{
 	};
@@ -97,6 +114,50 @@ namespace robotick::registry
 	{
 	};
 
+	// --- Scheduling traits ---
+
+	// A workload declaring `static constexpr bool is_event_driven = true;` is only ticked once new data has arrived for it
+	template <typename T, typename = void> struct is_event_driven_workload : FalseType<>
+	{
+	};
+	template <typename T> struct is_event_driven_workload<T, void_t<decltype(T::is_event_driven)>> : BoolConstant<T::is_event_driven>
+	{
+	};
+
+	// A workload whose tick() returns AsyncTickStatus can suspend part-way through its tick body (see AsyncTick.h)
+	template <typename T, typename = void> struct is_async_workload : FalseType<>
+	{
+	};
+	template <typename T>
+	struct is_async_workload<T, void_t<decltype(declval<T>().tick(declval<const TickInfo&>()))>>
+		: BoolConstant<is_same_v<decltype(declval<T>().tick(declval<const TickInfo&>())), AsyncTickStatus>>
+	{
+	};
+
+	// --- Persistence traits ---
+
+	// A workload declaring `static constexpr bool is_checkpointable = true;` holds nothing but plain data (no pointers, State<> or
+	// Blackboards), so checkpoints save all of it - private members included - rather than just its config, inputs and outputs
+	template <typename T, typename = void> struct is_checkpointable_workload : FalseType<>
+	{
+	};
+	template <typename T> struct is_checkpointable_workload<T, void_t<decltype(T::is_checkpointable)>> : BoolConstant<T::is_checkpointable>
+	{
+	};
+
+	// --- Relocation traits ---
+
+	// A workload of a model with blackboards is constructed and pre-loaded in a staging buffer, then moved byte-for-byte into the
+	// final one before load() (see Engine::relocate_workloads_buffer). That's only allowed for trivially copyable types, or those
+	// declaring `static constexpr bool is_relocatable = true;` - which keep no pointers into themselves (or any other workload),
+	// bar IoReactor watch owners, from construction until load()
+	template <typename T, typename = void> struct is_relocatable_workload : BoolConstant<is_trivially_copyable_v<T>>
+	{
+	};
+	template <typename T> struct is_relocatable_workload<T, void_t<decltype(T::is_relocatable)>> : BoolConstant<T::is_relocatable>
+	{
+	};
+
 	// --- Optional member type resolution ---
 
 	template <typename T, bool Present = has_member_config<T>::value> struct config_type
@@ -176,6 +237,21 @@ namespace robotick::registry
 		static_cast<T*>(self)->tick(tick);
 	}
 
+	template <typename T> static AsyncTickStatus async_tick_fn(void* self, const TickInfo& tick)
+	{
+		return static_cast<T*>(self)->tick(tick);
+	}
+
+	template <typename T> static void tick_batch_fn(void* first_instance, size_t count, const TickInfo& tick)
+	{
+		T::tick_batch(tick, ArrayView<T>(static_cast<T*>(first_instance), count));
+	}
+
+	template <typename T> static bool has_work_fn(const void* self)
+	{
+		return static_cast<const T*>(self)->has_work();
+	}
+
 	template <typename T> static void stop_fn(void* self)
 	{
 		static_cast<T*>(self)->stop();
@@ -237,9 +313,19 @@ namespace robotick::registry
 			desc.start_fn = &start_fn<T>;
 		if constexpr (has_tick<T>::value)
 			desc.tick_fn = &tick_fn<T>;
+		if constexpr (is_async_workload<T>::value)
+			desc.async_tick_fn = &async_tick_fn<T>;
+		if constexpr (has_tick_batch<T>::value)
+			desc.tick_batch_fn = &tick_batch_fn<T>;
+		if constexpr (has_has_work<T>::value)
+			desc.has_work_fn = &has_work_fn<T>;
 		if constexpr (has_stop<T>::value)
 			desc.stop_fn = &stop_fn<T>;
 
+		desc.is_event_driven = is_event_driven_workload<T>::value;
+		desc.is_checkpointable = is_checkpointable_workload<T>::value;
+		desc.is_relocatable = is_relocatable_workload<T>::value;
+
 		return desc;
 	}
 
@@ -0,0 +1,74 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/concurrency/WorkerPool.h"
+#include "robotick/framework/containers/FixedVector.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
+#include "robotick/framework/time/Clock.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace robotick
+{
+	class AtomicFlag;
+	class Engine;
+
+	/**
+	 * @brief Runs several loaded Engines from one thread, multiplexing their tick deadlines.
+	 *
+	 * Each engine keeps its own WorkloadsBuffer, tick-rate and overrun policy (and telemetry port, so give each model its own).
+	 * The scheduler repeatedly ticks whichever engines are due (via Engine::step()) and then sleeps on a single TickTimer until
+	 * the earliest next deadline - rather than every engine needing an OS thread of its own, each spinning on its own sleep.
+	 *
+	 * Engines falling due together tick in parallel on the scheduler's WorkerPool, which is also lent to any engine that has no
+	 * pool of its own (for its Dataflow levels and parallel groups). With worker threads, an engine's ticks may therefore run on
+	 * any pool thread; its start_fn and stop_fn still run on the thread calling run().
+	 */
+	class ROBOTICK_API EngineScheduler
+	{
+	  public:
+		EngineScheduler() = default;
+		~EngineScheduler();
+
+		EngineScheduler(const EngineScheduler&) = delete;
+		EngineScheduler& operator=(const EngineScheduler&) = delete;
+
+		// Number of threads (besides the one calling run()) to tick due engines on; 0 ticks them all on the calling thread.
+		void set_worker_thread_count(uint32_t in_worker_thread_count);
+		void set_tick_timer_backend(TickTimerBackend in_tick_timer_backend) { tick_timer_backend = in_tick_timer_backend; }
+
+		// The engine must already be loaded, and must stay alive for as long as this scheduler.
+		void add_engine(Engine& engine);
+		size_t get_engine_count() const { return engines.size(); }
+
+		// The stop_flag must outlive this call. Do not pass temporaries.
+		void run(const AtomicFlag& stop_after_next_tick_flag);
+
+		void run(const AtomicFlag&&) = delete; // cause compile-error if a temporary is used
+
+	  private:
+		struct ScheduledEngine
+		{
+			Engine* engine = nullptr;
+			Clock::time_point next_tick_time;
+		};
+
+		static void step_engine_task(void* context, uint32_t index);
+
+		FixedVector<ScheduledEngine, DEFAULT_MAX_SCHEDULED_ENGINES> engines;
+
+		// one task per engine, of which each round submits those that are due:
+		WorkerTask step_tasks[DEFAULT_MAX_SCHEDULED_ENGINES];
+		WorkerTask* due_tasks[DEFAULT_MAX_SCHEDULED_ENGINES] = {};
+
+		WorkerPool worker_pool;
+		uint32_t worker_thread_count = 0;
+		TickTimerBackend tick_timer_backend = TickTimerBackend::Hybrid;
+		bool is_running = false;
+	};
+
+} // namespace robotick
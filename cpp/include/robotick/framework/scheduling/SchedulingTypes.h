@@ -0,0 +1,61 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+namespace robotick
+{
+	// How the TickPlan orders the children of workloads it sequences itself (i.e. those without a tick_fn):
+	enum class TickSchedulingMode : uint8_t
+	{
+		Sequenced,	// children tick one after another, in model order
+		Dataflow,	// children are levelled by their data-connections; each level ticks in parallel on the worker pool
+		Hyperperiod // a static per-slot dispatch table over the hyperperiod of all rates, with slower workloads phase-balanced
+	};
+
+	// What Engine::run() does with the tick schedule when the root's tick finishes after the next one was due:
+	enum class OverrunPolicy : uint8_t
+	{
+		CatchUp,		// keep the original schedule, so missed ticks run back-to-back until it is caught up
+		SkipAndRealign, // drop the missed ticks and resume on the next slot of the original schedule
+		StretchPeriod	// start the next tick straight away and measure the schedule from there
+	};
+
+	// How Engine::run() waits for the next tick (see TickTimer):
+	enum class TickTimerBackend : uint8_t
+	{
+		Hybrid,		   // Thread::hybrid_sleep_until() - short sleeps, then spin through the last 2ms
+		AbsoluteSleep, // a single sleep to an absolute deadline (clock_nanosleep on Linux) - cheapest, but wakes with OS latency
+		TimerFd,	   // block on a timerfd armed with the absolute deadline (Linux; other platforms use AbsoluteSleep)
+		Spin,		   // never sleep - lowest jitter, but occupies a whole core
+		AdaptiveHybrid // sleep until the learned oversleep margin before the deadline, then spin for only that margin
+	};
+
+	// What the watchdog does once a workload's tick has run past its budget (see WorkloadWatchdogSeed) - it always logs first:
+	enum class WatchdogAction : uint8_t
+	{
+		Log,	   // log it (with a stack sample of the ticking thread) and carry on
+		SkipTicks, // as Log, then skip the workload's ticks from then on (the hung tick itself cannot be interrupted)
+		Stop	   // as Log, then stop the engine once the current tick returns
+	};
+
+	// How Engine::load() arranges workloads and their WorkloadInstanceStats in the WorkloadsBuffer:
+	enum class WorkloadsLayout : uint8_t
+	{
+		Interleaved, // each workload straight after its stats, in model order - the most compact
+		CacheAware	 // workloads packed in tick order, stats in a cold region after them, and any workload that can tick on a
+					 // different thread to its neighbours padded to whole cache lines (see DEFAULT_CACHE_LINE_BYTES)
+	};
+
+	// Where the WorkloadsBuffer's memory comes from:
+	enum class WorkloadsBufferAllocation : uint8_t
+	{
+		Heap,		 // operator new, zeroed - ordinary pages, which may be swapped out
+		LockedPages, // mapped from the OS (huge pages where it can), pre-faulted and locked into RAM - Heap where it refuses
+		SharedMemory // a named shared-memory segment, for other processes to read in place (see SharedWorkloadsBuffer.h) - Heap
+					 // where unavailable
+	};
+
+} // namespace robotick
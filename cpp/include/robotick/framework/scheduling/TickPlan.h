@@ -0,0 +1,242 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/framework/TickInfo.h"
+#include "robotick/framework/concurrency/AsyncTick.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/concurrency/WorkerPool.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
+
+#include <cstdint>
+#include <stddef.h>
+
+namespace robotick
+{
+	class DirtyRegionTracker;
+	class WorkloadsBuffer;
+	struct DataConnectionInfo;
+	struct WorkloadInstanceInfo;
+	struct WorkloadInstanceStats;
+
+	struct TickPlanEntry
+	{
+		static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+		// constant once compiled:
+		void (*tick_fn)(void*, const TickInfo&) = nullptr;
+		AsyncTickStatus (*async_tick_fn)(void*, const TickInfo&) = nullptr; // used instead of tick_fn, if set
+		void (*tick_batch_fn)(void*, size_t, const TickInfo&) = nullptr;	  // used instead of either, if set
+		bool (*has_work_fn)(const void*) = nullptr; // asked before each due tick (of each element, if instanced) - false skips it
+		void* instance_ptr = nullptr; // first element, if instanced
+		uint32_t instance_count = 1;
+		uint8_t* outputs_ptr = nullptr; // first element's outputs, spanning to the end of the last element's (null = no outputs)
+		size_t outputs_size = 0;
+		WorkloadInstanceStats* workload_stats = nullptr;
+		const WorkloadInstanceInfo* instance_info = nullptr;
+
+		uint32_t parent_index = INVALID_INDEX;
+		uint32_t subtree_end = 0;		// one past the last entry of this workload's subtree (entries are stored in pre-order)
+		uint32_t connections_begin = 0; // range within TickPlan::get_connections() applied just before this entry ticks
+		uint32_t connections_count = 0;
+		uint32_t child_batch_begin = 0; // this entry's private region of TickPlan's task-batch scratch (one slot per direct child)
+		uint32_t dataflow_levels_begin = 0; // range within TickPlan's dataflow levels (only set when built in Dataflow mode)
+		uint32_t dataflow_levels_count = 0;
+		uint32_t tick_rate_divisor = 1; // number of parent ticks per tick of this entry
+		uint32_t hyperperiod_divisor = 0; // number of root ticks per tick of this entry (only set when built in Hyperperiod mode)
+		uint32_t hyperperiod_phase = 0;	  // root tick, modulo hyperperiod_divisor, on which this entry ticks
+		uint32_t tick_budget_ns = 0;	  // 1 / tick_rate_hz, used to record overruns
+		float tick_rate_hz = 0.0f;
+		bool is_event_driven = false; // only ticks (when due) once new inputs have arrived - see registry::is_event_driven_workload
+		uint32_t dedicated_thread_index = INVALID_INDEX; // set on the top of a subtree placed on a thread of its own
+		uint32_t thread_index = INVALID_INDEX;			 // dedicated thread this entry ticks on (inherited; INVALID = tick thread)
+		uint64_t watchdog_budget_ns = 0;				 // longest a tick may run before the Watchdog trips (0 = unwatched)
+		WatchdogAction watchdog_action = WatchdogAction::Log;
+
+		// updated while running:
+		uint32_t ticks_until_due = 0;
+		uint32_t last_delta_ns = 0;
+		TickInfo tick_info;
+		bool has_pending_event = false; // new inputs have arrived since an event-driven entry last ticked
+		bool is_awaiting_io = false;	// an async entry's last tick returned AwaitingIo - skipped until woken like an event
+
+		// only maintained for watched entries, and read by the Watchdog's thread:
+		AtomicValue<uint64_t> watchdog_tick_start_ns{0}; // steady-clock time the current tick began (0 = not ticking)
+		AtomicValue<Thread::ThreadId> watchdog_tick_thread{0};
+		AtomicFlag is_watchdog_skipping; // set by WatchdogAction::SkipTicks - the entry is never due again
+
+		bool has_tick() const { return tick_fn != nullptr || tick_batch_fn != nullptr; }
+		bool is_engine_sequenced() const { return !has_tick(); }
+	};
+
+	class TickPlan;
+
+	// Ticks one subtree placed on a thread of its own (see WorkloadPlacementSeed): the plan hands it each due tick, and waits
+	// for it before the parent's tick completes.
+	struct TickPlanDedicatedThread
+	{
+		TickPlan* plan = nullptr;
+		uint32_t entry_index = TickPlanEntry::INVALID_INDEX;
+		int core = -1;
+
+		Thread thread;
+		Mutex mutex;
+		ConditionVariable condition;
+		bool is_started = false;	   // its subtree's start_fns have run (on the dedicated thread itself)
+		bool has_tick_pending = false; // set by the parent's thread; cleared once the subtree has ticked
+		bool is_stopping = false;
+		bool has_exited = false;
+	};
+
+	struct TickPlanDataflowLevel
+	{
+		uint32_t begin = 0; // range within TickPlan's dataflow level entries
+		uint32_t count = 0;
+	};
+
+	/**
+	 * @brief Flat, pre-ordered copy of the workload tree, compiled once by Engine::load().
+	 *
+	 * Each entry carries everything needed to tick a workload (function pointer, instance pointer, stats, rate divisor and the
+	 * data-connections to apply beforehand), so walking a subtree is a linear scan over contiguous memory rather than a chase
+	 * through WorkloadInstanceInfo children and descriptors.
+	 *
+	 * Workloads without a tick_fn are "engine-sequenced": the plan ticks their children in order on their behalf, and claims any
+	 * otherwise unassigned data-connections feeding those children. Group workloads with their own tick_fn can still use
+	 * tick_children() to run their subtree from the plan (in which case they must not also copy their claimed connections).
+	 */
+	class TickPlan
+	{
+	  public:
+		/// @brief Flattens the tree under root (which must live in instances) into contiguous pre-ordered entries
+		void compile(const WorkloadInstanceInfo& root, const HeapVector<WorkloadInstanceInfo>& instances, WorkloadsBuffer& workloads_buffer);
+
+		/// @brief Claims unassigned connections feeding engine-sequenced children, and attaches group/plan-handled connections to
+		/// the entry that consumes them. Must be called after set_children_fn and before the Engine acquires remaining connections.
+		void bind_connections(HeapVector<DataConnectionInfo>& connections);
+
+		/// @brief Orders the children of every engine-sequenced entry into dependency levels derived from the connections the plan
+		/// applies: a child sits one level after the latest sibling (subtree) feeding it. Each level then ticks in parallel, with
+		/// connections copied just before their consumer runs. Dependency cycles between siblings are fatal.
+		void build_dataflow_levels();
+
+		/// @brief Flattens every workload sequenced by the plan from the root into a static table with one slot per root tick over
+		/// the hyperperiod (LCM of all rate divisors), so ticking needs no rate arithmetic. Each slower workload is given the phase
+		/// offset that keeps the busiest slot as light as possible. Only applies when the root itself is engine-sequenced.
+		void build_hyperperiod_table();
+
+		uint32_t get_hyperperiod_slot_count() const { return hyperperiod_slot_count; }
+		const HeapVector<uint32_t>& get_hyperperiod_slot_offsets() const { return hyperperiod_slot_offsets; }
+		const HeapVector<uint32_t>& get_hyperperiod_slot_entries() const { return hyperperiod_slot_entries; }
+
+		/// @brief Resets runtime counters, starts any dedicated threads, and calls start_fn on every workload the plan itself is
+		/// responsible for starting (on the thread that will tick it). The exception is workloads ticked on the worker pool (by
+		/// tick_children_parallel() or dataflow levels), which may tick on any pool thread: their start_fn runs on the thread
+		/// calling start(), so they must not cache thread-affine handles there.
+		void start();
+
+		/// @brief Stops any dedicated threads (after they finish a pending tick)
+		void stop();
+
+		~TickPlan() { stop(); }
+
+		/// @brief Ticks the root entry with the given TickInfo (stats for the root are recorded by the caller)
+		void tick_root(const TickInfo& root_tick_info);
+
+		/// @brief Ticks every due child of parent_index in order, applying each child's connections first
+		void tick_children(uint32_t parent_index, const TickInfo& parent_tick_info);
+
+		/// @brief Applies the connections of every due child of parent_index, then ticks those children concurrently on the
+		/// worker pool, returning once all have finished (falls back to tick_children() when no pool is set). Each tick may land on
+		/// a different pool thread from the last - and from the one that ran the child's start_fn.
+		void tick_children_parallel(uint32_t parent_index, const TickInfo& parent_tick_info);
+
+		void set_worker_pool(WorkerPool* in_worker_pool) { worker_pool = in_worker_pool; }
+
+		// Marks each ticked workload's outputs and stats, and each changed connection's destination (nullptr = don't track)
+		void set_dirty_regions(DirtyRegionTracker* in_dirty_regions) { dirty_regions = in_dirty_regions; }
+		WorkerPool* get_worker_pool() const { return worker_pool; }
+
+		/// @brief Flags that new inputs have arrived for this entry, so it ticks when next due even if event-driven (tick thread only)
+		void mark_event(uint32_t index)
+		{
+			if (index != TickPlanEntry::INVALID_INDEX)
+				entries[index].has_pending_event = true;
+		}
+
+		uint32_t find_entry_index(const WorkloadInstanceInfo& instance) const;
+
+		/// @brief Enables or disables an entry - and with it, its whole subtree - from its next due tick. Disabled entries are skipped
+		/// without calling any tick function (counted in their skipped_tick_count). All are enabled once compiled. Tick thread only.
+		void set_entry_enabled(uint32_t index, bool is_enabled)
+		{
+			ROBOTICK_ASSERT_MSG(index < entries.size(), "TickPlan::set_entry_enabled() - invalid entry index %u", index);
+			const uint64_t bit = 1ull << (index % 64);
+			enable_mask[index / 64] = is_enabled ? (enable_mask[index / 64] | bit) : (enable_mask[index / 64] & ~bit);
+		}
+
+		bool is_entry_enabled(uint32_t index) const { return (enable_mask[index / 64] >> (index % 64)) & 1ull; }
+
+		/// @brief One bit per entry (in entry order), set while the entry is enabled
+		const HeapVector<uint64_t>& get_enable_mask() const { return enable_mask; }
+
+		const HeapVector<TickPlanEntry>& get_entries() const { return entries; }
+		HeapVector<TickPlanEntry>& get_entries() { return entries; }
+		const HeapVector<const DataConnectionInfo*>& get_connections() const { return connections; }
+		const HeapVector<TickPlanDataflowLevel>& get_dataflow_levels() const { return dataflow_levels; }
+		const HeapVector<uint32_t>& get_dataflow_level_entries() const { return dataflow_level_entries; }
+		const HeapVector<TickPlanDedicatedThread>& get_dedicated_threads() const { return dedicated_threads; }
+
+		bool is_compiled() const { return !entries.empty(); }
+
+	  private:
+		void append_subtree(const WorkloadInstanceInfo& instance, uint32_t parent_index, uint32_t& cursor, WorkloadsBuffer& workloads_buffer);
+
+		void tick_children_dataflow(uint32_t parent_index, const TickInfo& parent_tick_info);
+		void tick_hyperperiod_children(uint32_t parent_index, const TickInfo& parent_tick_info);
+		bool prepare_child(uint32_t index, const TickInfo& parent_tick_info);
+		bool prepare_due_child(uint32_t index, const TickInfo& parent_tick_info);
+		bool is_entry_runnable(uint32_t index) const;
+		void run_child(uint32_t index);
+		void dispatch(TickPlanEntry& entry, uint32_t index, const TickInfo& tick_info);
+		void copy_connections(const TickPlanEntry& entry, bool& has_event);
+		void mark_entry_written(const TickPlanEntry& entry, bool is_ticked);
+		void start_entry(uint32_t index);
+
+		/// @brief Runs a prepared child here, or hands it to its dedicated thread - returning true if so (see wait_for_dedicated_children)
+		bool launch_child(uint32_t index);
+		void wait_for_dedicated_children(uint32_t parent_index);
+
+		static void run_child_task(void* context, uint32_t index);
+		static void dedicated_thread_entry(void* arg);
+
+		HeapVector<TickPlanEntry> entries;
+		HeapVector<const DataConnectionInfo*> connections;
+		HeapVector<uint32_t> entry_index_by_instance; // indexed by position within Engine's instances array
+
+		WorkerPool* worker_pool = nullptr;
+		DirtyRegionTracker* dirty_regions = nullptr;
+		HeapVector<WorkerTask> child_tasks;		 // one per entry, reused every tick
+		HeapVector<WorkerTask*> child_task_batch; // scratch for gathering due children (see TickPlanEntry::child_batch_begin)
+
+		HeapVector<TickPlanDataflowLevel> dataflow_levels;
+		HeapVector<uint32_t> dataflow_level_entries;
+
+		uint32_t hyperperiod_slot_count = 0;
+		uint32_t hyperperiod_slot_cursor = 0;	// the slot the root's next tick runs
+		uint32_t hyperperiod_slot_ticking = 0; // the slot the root's current tick runs
+		HeapVector<uint32_t> hyperperiod_slot_offsets; // slot_count + 1 offsets into hyperperiod_slot_entries
+		HeapVector<uint32_t> hyperperiod_slot_entries;
+
+		HeapVector<TickPlanDedicatedThread> dedicated_threads;
+
+		HeapVector<uint64_t> enable_mask; // see set_entry_enabled()
+
+		const WorkloadInstanceInfo* instances_begin = nullptr;
+	};
+
+} // namespace robotick
@@ -0,0 +1,68 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/containers/HeapVector.h"
+
+#include <cstdint>
+
+namespace robotick
+{
+	class TickPlan;
+
+	/**
+	 * @brief Polices the per-tick budgets of watched TickPlan entries (see WorkloadWatchdogSeed) while their ticks are running.
+	 *
+	 * Each watched entry stamps its tick's start time (and thread) as it begins, and clears it as it returns. A low-priority
+	 * thread checks those stamps every DEFAULT_WATCHDOG_POLL_INTERVAL_MS, and trips once for any tick that has run past its
+	 * budget: logging the workload and a stack sample of the thread running it, then applying the entry's WatchdogAction.
+	 * Unwatched entries cost nothing, and watched ones two atomic stores per tick.
+	 */
+	class ROBOTICK_API Watchdog
+	{
+	  public:
+		Watchdog() = default;
+		~Watchdog() { stop(); }
+
+		Watchdog(const Watchdog&) = delete;
+		Watchdog& operator=(const Watchdog&) = delete;
+
+		/// @brief Starts the watchdog thread if any of the plan's entries are watched (the plan must outlive stop())
+		void start(TickPlan& tick_plan);
+		void stop();
+
+		bool is_running() const { return is_thread_running; }
+
+		/// @brief Set once a WatchdogAction::Stop trips - the Engine stops after the current tick (cleared by start())
+		bool is_stop_requested() const { return stop_requested.is_set(); }
+
+		/// @brief Checks every watched entry once, against the given steady-clock time (as the thread does each poll).
+		/// Safe from any thread - tests call it with times of their own choosing, rather than waiting on the real clock.
+		void check(uint64_t now_ns);
+
+	  private:
+		static void thread_entry(void* arg);
+
+		void check_locked(uint64_t now_ns);
+
+		void trip(uint32_t entry_index, uint64_t tick_elapsed_ns);
+
+		TickPlan* tick_plan = nullptr;
+		HeapVector<uint32_t> watched_entry_indices;
+		HeapVector<uint64_t> tripped_tick_start_ns; // per watched entry, the tick it last tripped on - so each trips only once
+
+		Thread thread;
+		Mutex mutex;
+		ConditionVariable condition;
+		bool is_stopping = false;
+		bool is_thread_running = false;
+
+		AtomicFlag stop_requested;
+	};
+
+} // namespace robotick
@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace robotick
 {
 
@@ -13,6 +16,39 @@ namespace robotick
 	  public:
 		/// Perform platform-specific system initialization (e.g. board init hooks, signal handlers, etc)
 		static void initialize();
+
+		/// Asks the OS to place the pages spanning [ptr, ptr + size) on the given NUMA node, migrating any already touched.
+		/// Page-granular and best-effort: returns false where unsupported (or refused), leaving placement to the OS.
+		static bool bind_memory_to_numa_node(void* ptr, size_t size, int numa_node);
+
+		/// Maps at least size bytes of zeroed memory for latency-critical use: on huge pages where the platform can, with every page
+		/// pre-faulted, and locked into RAM if allowed (out_is_locked says whether it was). Returns nullptr where unsupported (or
+		/// refused), for the caller to fall back to the heap. Release it with unmap_locked_memory(ptr, out_mapped_size).
+		static void* map_locked_memory(size_t size, size_t& out_mapped_size, bool& out_is_locked);
+		static void unmap_locked_memory(void* ptr, size_t mapped_size);
+
+		/// Creates a named shared-memory segment (a POSIX name, e.g. "/robotick_arm") of at least size zeroed bytes, mapped
+		/// read-write. Returns nullptr where unsupported (or refused) - or if a segment of that name already exists, when
+		/// out_already_exists is set and the existing one is left alone (for the caller to judge whether it is stale, and unlink
+		/// it if so). Release it with unmap_shared_memory(ptr, out_mapped_size), and remove the name with unlink_shared_memory().
+		static void* create_shared_memory(const char* name, size_t size, size_t& out_mapped_size, bool& out_already_exists);
+
+		/// Maps all of an existing named segment read-only (e.g. from another process) - nullptr if there is none.
+		static const void* open_shared_memory(const char* name, size_t& out_mapped_size);
+		static void unmap_shared_memory(const void* ptr, size_t mapped_size);
+		static void unlink_shared_memory(const char* name);
+
+		/// This process's id, and whether the process with the given id is still running (true where that can't be told, so
+		/// callers never mistake a live process for a dead one) - e.g. to tell a shared-memory segment's owner has gone.
+		static int64_t get_process_id();
+		static bool is_process_alive(int64_t process_id);
+
+		/// Samples the call stack of a running thread (as returned by Thread::get_current_thread_id() on it), e.g. one stuck in a
+		/// tick. Returns how many return addresses were written to out_frames - 0 where unsupported, or if it didn't respond.
+		static size_t capture_thread_stack(uintptr_t thread_id, void** out_frames, size_t max_frames);
+
+		/// Logs frames from capture_thread_stack(), symbolised where the platform can.
+		static void log_stack_frames(void* const* frames, size_t frame_count);
 	};
 
 } // namespace robotick
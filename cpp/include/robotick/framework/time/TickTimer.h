@@ -0,0 +1,134 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/scheduling/SchedulingTypes.h"
+#include "robotick/framework/time/Clock.h"
+
+#include <cstdint>
+
+namespace robotick
+{
+	/**
+	 * @brief Waits for tick deadlines using a selectable TickTimerBackend, and reports how late each wake-up was.
+	 *
+	 * AdaptiveHybrid tracks a running mean and deviation of how far past its target the OS sleep overshoots, and only spins
+	 * for that learned margin (between ADAPTIVE_MIN_MARGIN_NS and ADAPTIVE_MAX_MARGIN_NS) instead of a fixed 2ms.
+	 */
+	class TickTimer
+	{
+	  public:
+		static constexpr int64_t ADAPTIVE_MIN_MARGIN_NS = 20000;
+		static constexpr int64_t ADAPTIVE_MAX_MARGIN_NS = 2000000;
+
+		TickTimer() = default;
+		~TickTimer() { stop(); }
+
+		TickTimer(const TickTimer&) = delete;
+		TickTimer& operator=(const TickTimer&) = delete;
+
+		void start(TickTimerBackend in_backend);
+		void stop();
+
+		/// @brief Returns once target_time has passed; the result is how many nanoseconds after target_time that was
+		uint32_t sleep_until(Clock::time_point target_time)
+		{
+			switch (backend)
+			{
+			case TickTimerBackend::Hybrid:
+				Thread::hybrid_sleep_until(target_time);
+				break;
+			case TickTimerBackend::AbsoluteSleep:
+				sleep_absolute(target_time);
+				break;
+			case TickTimerBackend::TimerFd:
+				sleep_timer_fd(target_time);
+				break;
+			case TickTimerBackend::Spin:
+				spin_until(target_time);
+				break;
+			case TickTimerBackend::AdaptiveHybrid:
+				sleep_adaptive(target_time);
+				break;
+			}
+
+			const int64_t late_ns = Clock::to_nanoseconds(Clock::now() - target_time).count();
+			return late_ns > 0 ? detail::clamp_to_uint32(static_cast<uint64_t>(late_ns)) : 0;
+		}
+
+		/// @brief As sleep_until(), but returns false as soon as wake_flag is set (or woken) - true once target_time has passed.
+		/// Blocks on the flag until the last ADAPTIVE_MAX_MARGIN_NS, which the backend then sleeps as precisely as ever.
+		bool sleep_until_or_woken(Clock::time_point target_time, const AtomicFlag& wake_flag)
+		{
+			const auto wake_target = target_time - Clock::nanoseconds(ADAPTIVE_MAX_MARGIN_NS);
+			if (Clock::now() < wake_target)
+			{
+				wake_flag.wait_until(wake_target);
+				if (Clock::now() < wake_target)
+					return false;
+			}
+
+			sleep_until(target_time);
+			return true;
+		}
+
+		TickTimerBackend get_backend() const { return backend; }
+		int64_t get_adaptive_margin_ns() const { return adaptive_margin_ns; }
+
+	  private:
+		// platform-specific (see backends/*/TickTimer_*.inl):
+		void sleep_absolute(Clock::time_point target_time);
+		void sleep_timer_fd(Clock::time_point target_time);
+
+		static void spin_until(Clock::time_point target_time)
+		{
+			while (Clock::now() < target_time)
+			{
+			}
+		}
+
+		void sleep_adaptive(Clock::time_point target_time)
+		{
+			const auto wake_target = target_time - Clock::nanoseconds(adaptive_margin_ns);
+			if (Clock::now() < wake_target)
+			{
+				sleep_absolute(wake_target);
+
+				// learn how far past its target the OS sleep lands (EWMA with 1/16 weight), spinning for mean + 4 deviations:
+				const int64_t oversleep_ns = Clock::to_nanoseconds(Clock::now() - wake_target).count();
+				const int64_t error_ns = oversleep_ns - oversleep_mean_ns;
+				oversleep_mean_ns += error_ns / 16;
+				oversleep_deviation_ns += ((error_ns < 0 ? -error_ns : error_ns) - oversleep_deviation_ns) / 16;
+
+				const int64_t margin_ns = oversleep_mean_ns + 4 * oversleep_deviation_ns;
+				adaptive_margin_ns = margin_ns < ADAPTIVE_MIN_MARGIN_NS	  ? ADAPTIVE_MIN_MARGIN_NS
+									 : margin_ns > ADAPTIVE_MAX_MARGIN_NS ? ADAPTIVE_MAX_MARGIN_NS
+																		  : margin_ns;
+			}
+
+			spin_until(target_time);
+		}
+
+		TickTimerBackend backend = TickTimerBackend::Hybrid;
+		int timer_fd = -1;
+
+		// AdaptiveHybrid starts out as cautious as Hybrid, and tightens as it learns:
+		int64_t adaptive_margin_ns = ADAPTIVE_MAX_MARGIN_NS;
+		int64_t oversleep_mean_ns = 0;
+		int64_t oversleep_deviation_ns = 0;
+	};
+
+} // namespace robotick
+
+// Platform-specific implementation
+#if defined(ROBOTICK_PLATFORM_ESP32S3)
+#include "robotick/framework/backends/esp32/TickTimer_esp32.inl"
+#elif defined(ROBOTICK_PLATFORM_DESKTOP)
+#include "robotick/framework/backends/desktop/TickTimer_desktop.inl"
+#else
+#error "No TickTimer implementation for this platform – define a platform macro or add a generic fallback"
+#endif
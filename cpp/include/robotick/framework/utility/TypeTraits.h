@@ -17,6 +17,7 @@ namespace robotick
 
 	template <typename T = void> using TrueType = std_approved::true_type;
 	template <typename T = void> using FalseType = std_approved::false_type;
+	template <bool B> using BoolConstant = std_approved::bool_constant<B>;
 
 	template <typename T> using identity = T;
 	template <typename T> T&& declval() noexcept;
@@ -29,6 +30,7 @@ namespace robotick
 	template <typename T> constexpr bool is_nothrow_move_constructible_v = std_approved::is_nothrow_move_constructible<T>::value;
 	template <typename T> constexpr bool is_pointer_v = std_approved::is_pointer<T>::value;
 	template <typename T> constexpr bool is_enum_v = std_approved::is_enum<T>::value;
+	template <typename A, typename B> constexpr bool is_same_v = std_approved::is_same<A, B>::value;
 	template <typename T> constexpr bool is_signed_v = std_approved::is_signed<T>::value;
 	template <typename T> using underlying_type_t = typename std_approved::underlying_type<T>::type;
 } // namespace robotick
@@ -24,6 +24,7 @@ namespace robotick
 		const FieldDescriptor* field_info = nullptr;
 		const FieldDescriptor* subfield_info = nullptr; // DEPRECATED - remove soon - use "for_each_field_in_struct_field()" instead
 		void* field_ptr = nullptr;
+		uint32_t element_index = 0; // which element of an instanced workload the field belongs to (0 otherwise)
 
 		bool is_struct_field() const;
 		const StructDescriptor* get_field_struct_desc() const;
@@ -41,6 +42,7 @@ namespace robotick
 
 		static void for_each_field_in_struct_field(const WorkloadFieldView& parent_field, Function<void(const WorkloadFieldView&)> callback);
 
+		// (visits each element's fields in turn, for instanced workloads)
 		static void for_each_field_in_workload(const Engine& engine,
 			const WorkloadInstanceInfo& instance,
 			WorkloadsBuffer* workloads_override,
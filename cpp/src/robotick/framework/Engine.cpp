@@ -5,39 +5,103 @@
 
 #include "robotick/api.h"
 #include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/IoReactor.h"
+#include "robotick/framework/concurrency/Sync.h"
 #include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/concurrency/WorkerPool.h"
 #include "robotick/framework/data/Blackboard.h"
 #include "robotick/framework/data/DataConnection.h"
+#include "robotick/framework/data/DirtyRegionTracker.h"
 #include "robotick/framework/data/RemoteEngineConnections.h"
 #include "robotick/framework/data/TelemetryServer.h"
 #include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
+#include "robotick/framework/data/WorkloadsCheckpoint.h"
+#include "robotick/framework/memory/MemoryArena.h"
 #include "robotick/framework/model/Model.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "robotick/framework/scheduling/Watchdog.h"
 #include "robotick/framework/services/WebServer.h"
 #include "robotick/framework/system/PlatformEvents.h"
 #include "robotick/framework/system/System.h"
 #include "robotick/framework/time/Clock.h"
+#include "robotick/framework/time/TickTimer.h"
+#include "robotick/framework/utility/Algorithm.h"
 #include "robotick/framework/utils/TypeId.h"
 
+#include <nlohmann/json.hpp>
+
 #include <cstddef>
+#include <cstring>
 
 namespace robotick
 {
+	nlohmann::ordered_json build_workloads_buffer_layout_json(const Engine& engine, const char* session_id_override);
+
 	struct Engine::State
 	{
+		// what loading allocates, if the model enables it - declared first, so it outlives everything allocated from it:
+		MemoryArena arena;
+
 		const Model* model = nullptr;
-		bool is_running = false;
+		AtomicFlag is_running;
+
+		// stop() support - it sets stop_requested, wakes whatever the run sleeps on, and waits for has_run_finished. A request made
+		// with no run in progress is held for the next one, and a run's request is only cleared once it has finished. The run's
+		// wake flag is the caller's, gone once run() returns, so it is only set, cleared or woken under stop_mutex:
+		Mutex stop_mutex;
+		AtomicFlag stop_requested;
+		AtomicFlag has_run_finished{true}; // (no run in progress)
+		AtomicValue<const AtomicFlag*> run_wake_flag{nullptr};
 
 		WorkloadsBuffer workloads_buffer;
+		WorkloadsBufferSnapshots workloads_buffer_snapshots;
+		DirtyRegionTracker dirty_regions;
+
+		// save_checkpoint() support - the tick thread copies out the frame that ends after checkpoint_requested is set:
+		WorkloadsCheckpoint checkpoint;
+		Mutex checkpoint_mutex;
+		ConditionVariable checkpoint_captured;
+		AtomicFlag checkpoint_requested;
 
 		TelemetryServer telemetry_server;
 
 		const WorkloadInstanceInfo* root_instance = nullptr;
 		HeapVector<WorkloadInstanceInfo> instances;
+		HeapVector<const WorkloadInstanceInfo*> instances_by_offset; // ascending offset (not model order, with a CacheAware layout)
 		Map<const char*, WorkloadInstanceInfo*> instances_by_unique_name;
 		HeapVector<DataConnectionInfo> data_connections_all;
 		HeapVector<DataConnectionInfo*> data_connections_acquired;
 
+		TickPlan tick_plan;
+		WorkerPool worker_pool;
+
 		RemoteEngineConnections remote_engine_connections;
+
+		IoReactor io_reactor;
+
+		Watchdog watchdog;
+
+		// bool fields read into the tick plan's enable mask at the start of every frame (see WorkloadEnableSeed):
+		struct EnableBinding
+		{
+			const bool* enable_ptr = nullptr;
+			uint32_t entry_index = TickPlanEntry::INVALID_INDEX;
+		};
+		HeapVector<EnableBinding> enable_bindings;
+
+		// real-time schedule, advanced by step():
+		struct SteppedRun
+		{
+			Clock::time_point start_time;
+			Clock::time_point last_tick_time;
+			Clock::time_point next_tick_time; // deadline of the next step()
+			Clock::duration tick_interval{};
+			uint32_t budget_ns = 0;
+			OverrunPolicy overrun_policy = OverrunPolicy::CatchUp;
+			TickInfo tick_info;
+		};
+		SteppedRun stepped_run;
 	};
 
 	Engine::Engine()
@@ -47,6 +111,7 @@ namespace robotick
 
 	Engine::~Engine()
 	{
+		state->worker_pool.stop();
 		state->telemetry_server.stop();
 		state->remote_engine_connections.stop();
 
@@ -54,9 +119,9 @@ namespace robotick
 		{
 			if (instance.workload_descriptor->destruct_fn)
 			{
-				void* instance_ptr = instance.get_ptr(*this);
+				uint8_t* instance_ptr = instance.get_ptr(*this);
 				ROBOTICK_ASSERT(instance_ptr != nullptr);
-				instance.workload_descriptor->destruct_fn(instance_ptr);
+				instance.for_each_element(instance_ptr, instance.workload_descriptor->destruct_fn);
 			}
 		}
 		delete state;
@@ -78,18 +143,20 @@ namespace robotick
 		return true;
 	}
 
+	// Each blackboard's storage starts on this boundary, so its fields land where Blackboard::compute_total_datablock_size() sized
+	// them from (an aligned offset of 0) - wherever the workloads before it happen to end.
+	static constexpr size_t BLACKBOARD_STORAGE_ALIGNMENT = alignof(max_align_t);
+
 	// Clamp to max_align_t so the placement-new construction that follows always satisfies C++ object requirements.
 	static size_t max_align_for_type(size_t alignment)
 	{
 		return (alignment > alignof(max_align_t)) ? alignment : alignof(max_align_t);
 	}
 
-	// Ensure the cursor respects the max alignment of the upcoming type so every allocation remains well-aligned.
-	static bool align_workloads_cursor_for_type(const TypeDescriptor& type, size_t& workloads_cursor)
+	// Move the cursor forward to the next multiple of alignment, so the next placement-new starts at a compatible address.
+	static bool align_workloads_cursor(size_t alignment, size_t& workloads_cursor)
 	{
-		const size_t alignment = max_align_for_type(type.alignment);
-		// This should never fail, since max_align_for_type clamps to at least alignof(max_align_t),
-		// but we keep the division defensive to protect the cursor from bad alignments.
+		// Callers never pass 0, but we keep the division defensive to protect the cursor from bad alignments.
 		if (alignment == 0)
 			return false;
 		size_t remainder = workloads_cursor % alignment;
@@ -99,25 +166,393 @@ namespace robotick
 			size_t aligned_cursor = 0;
 			if (!safe_add_size(workloads_cursor, delta, aligned_cursor))
 				return false;
-			// Move the cursor forward so that the next placement-new starts at an address compatible with the target type.
 			workloads_cursor = aligned_cursor;
 		}
 		return true;
 	}
 
-	// Reserve space for the named type and record the advanced cursor so the next workload starts immediately after it.
-	static bool increment_workloads_cursor_for_type(const TypeDescriptor& type, size_t& workloads_cursor)
+	// Reserve space for count of the named type (an instanced workload's array) and record the advanced cursor so the next
+	// workload starts immediately after it.
+	static bool increment_workloads_cursor_for_type(const TypeDescriptor& type, size_t& workloads_cursor, size_t count = 1)
 	{
-		if (type.size == 0)
+		if (type.size == 0 || count == 0 || count > SIZE_MAX / type.size)
 			return false;
 		size_t next_cursor = 0;
-		if (!safe_add_size(workloads_cursor, type.size, next_cursor))
+		if (!safe_add_size(workloads_cursor, type.size * count, next_cursor))
 			return false;
 		// Advance past the object we just allocated so the following type begins immediately afterwards.
 		workloads_cursor = next_cursor;
 		return true;
 	}
 
+	// Where load() places one workload's instance(s) and its stats in the WorkloadsBuffer (see WorkloadsLayout).
+	struct WorkloadSlot
+	{
+		size_t stats_offset = 0;
+		size_t instance_offset = 0;
+		bool is_cross_thread = false; // may tick on a different thread to the workloads laid out either side of it
+	};
+
+	// Visits each workload once, in the pre-order the TickPlan ticks them in, recording its index in the model's seeds.
+	struct TickOrderWalk
+	{
+		Map<const char*, size_t> index_by_name;
+		HeapVector<bool> is_visited;
+		HeapVector<size_t> order;
+		size_t order_count = 0;
+
+		void visit(const WorkloadSeed& seed)
+		{
+			const size_t* index = index_by_name.find(seed.unique_name.c_str());
+			if (index == nullptr || is_visited[*index])
+				return;
+
+			is_visited[*index] = true;
+			order[order_count++] = *index;
+
+			for (const WorkloadSeed* child_seed : seed.children)
+			{
+				visit(*child_seed);
+			}
+		}
+	};
+
+	static void mark_subtree_cross_thread(const Map<const char*, size_t>& index_by_name, const WorkloadSeed& seed, HeapVector<WorkloadSlot>& slots)
+	{
+		const size_t* index = index_by_name.find(seed.unique_name.c_str());
+		if (index != nullptr)
+			slots[*index].is_cross_thread = true;
+
+		for (const WorkloadSeed* child_seed : seed.children)
+		{
+			mark_subtree_cross_thread(index_by_name, *child_seed, slots);
+		}
+	}
+
+	// Assigns every workload (and its stats) an offset in the WorkloadsBuffer, returning the total size they need.
+	//  - Interleaved: each workload straight after its stats, in model order.
+	//  - CacheAware: a hot region of workloads in tick order - those that may tick on another thread to their neighbours (any, with
+	//    worker threads; otherwise those under a dedicated-thread placement) starting and ending on cache lines - followed by a cold
+	//    region of stats, each on its own cache lines (they are written by whichever thread ticks their workload).
+	static size_t compute_workloads_layout(const Model& model, const TypeDescriptor& stats_type, HeapVector<WorkloadSlot>& slots)
+	{
+		const auto& seeds = model.get_workload_seeds();
+		slots.initialize(seeds.size());
+
+		size_t workloads_cursor = 0;
+
+		auto place_stats = [&](size_t index, size_t alignment)
+		{
+			const char* workload_name = seeds[index]->unique_name.c_str();
+			if (!align_workloads_cursor(alignment, workloads_cursor))
+				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while laying-out stats for workload '%s'", workload_name);
+			slots[index].stats_offset = workloads_cursor;
+			if (!increment_workloads_cursor_for_type(stats_type, workloads_cursor))
+				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while laying-out stats for workload '%s'", workload_name);
+		};
+
+		auto place_instance = [&](size_t index, size_t min_alignment)
+		{
+			const auto* workload_type = TypeRegistry::get().find_by_id(seeds[index]->type_id);
+			ROBOTICK_ASSERT_MSG(workload_type, "Unknown workload type: %s", seeds[index]->type_id.get_debug_name());
+
+			const size_t type_alignment = max_align_for_type(workload_type->alignment);
+			if (!align_workloads_cursor(type_alignment > min_alignment ? type_alignment : min_alignment, workloads_cursor))
+				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while laying-out workload type '%s'", workload_type->name.c_str());
+			slots[index].instance_offset = workloads_cursor;
+			if (!increment_workloads_cursor_for_type(*workload_type, workloads_cursor, seeds[index]->instance_count))
+				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while laying-out workload type '%s'", workload_type->name.c_str());
+		};
+
+		if (model.get_workloads_layout() == WorkloadsLayout::Interleaved)
+		{
+			for (size_t i = 0; i < seeds.size(); ++i)
+			{
+				// Stats/instance structs are colocated in the same buffer; align both as if they were independently allocated.
+				place_stats(i, max_align_for_type(stats_type.alignment));
+				place_instance(i, 0);
+			}
+			return workloads_cursor;
+		}
+
+		TickOrderWalk walk;
+		walk.is_visited.initialize(seeds.size());
+		walk.order.initialize(seeds.size());
+		for (size_t i = 0; i < seeds.size(); ++i)
+		{
+			walk.index_by_name.insert(seeds[i]->unique_name.c_str(), i);
+			walk.is_visited[i] = false;
+		}
+
+		walk.visit(*model.get_root_workload());
+		for (size_t i = 0; i < seeds.size(); ++i)
+		{
+			// anything the root doesn't reach still needs a home - after the rest, in model order
+			if (!walk.is_visited[i])
+			{
+				walk.is_visited[i] = true;
+				walk.order[walk.order_count++] = i;
+			}
+		}
+
+		if (model.get_worker_thread_count() > 0)
+		{
+			for (size_t i = 0; i < seeds.size(); ++i)
+			{
+				slots[i].is_cross_thread = true;
+			}
+		}
+		else
+		{
+			for (const WorkloadPlacementSeed* placement : model.get_workload_placements())
+			{
+				const size_t* placed_index = walk.index_by_name.find(placement->workload_name.c_str());
+				// the root's placement only pins the thread calling run(), which ticks everything not placed elsewhere anyway
+				if (placed_index != nullptr && placement->has_dedicated_thread() && seeds[*placed_index] != model.get_root_workload())
+					mark_subtree_cross_thread(walk.index_by_name, *seeds[*placed_index], slots);
+			}
+		}
+
+		// hot region:
+		for (size_t order_index = 0; order_index < walk.order_count; ++order_index)
+		{
+			const size_t index = walk.order[order_index];
+			if (!slots[index].is_cross_thread)
+			{
+				place_instance(index, 0);
+				continue;
+			}
+
+			place_instance(index, DEFAULT_CACHE_LINE_BYTES);
+			// pad out the rest of its last cache line, so the next workload can't share it:
+			if (!align_workloads_cursor(DEFAULT_CACHE_LINE_BYTES, workloads_cursor))
+				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while padding workload '%s'", seeds[index]->unique_name.c_str());
+		}
+
+		// cold region:
+		for (size_t i = 0; i < seeds.size(); ++i)
+		{
+			place_stats(i, DEFAULT_CACHE_LINE_BYTES > stats_type.alignment ? DEFAULT_CACHE_LINE_BYTES : stats_type.alignment);
+		}
+
+		if (!align_workloads_cursor(DEFAULT_CACHE_LINE_BYTES, workloads_cursor))
+			ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while padding workload stats");
+
+		return workloads_cursor;
+	}
+
+	namespace
+	{
+		struct LoadPhaseBatch
+		{
+			Engine* engine = nullptr;
+			HeapVector<WorkloadInstanceInfo>* instances = nullptr;
+			void (*load_step)(Engine&, WorkloadInstanceInfo&) = nullptr;
+			uint64_t WorkloadLoadTimings::*timing_ns = nullptr;
+			MemoryArena* arena = nullptr; // (the loading thread's, for workers to allocate from too)
+		};
+
+		void run_timed_load_step(const LoadPhaseBatch& batch, WorkloadInstanceInfo& instance)
+		{
+			const auto step_start = Clock::now();
+			batch.load_step(*batch.engine, instance);
+			instance.load_timings.*batch.timing_ns = static_cast<uint64_t>(Clock::to_nanoseconds(Clock::now() - step_start).count());
+		}
+
+		void run_load_step_task(void* context, uint32_t index)
+		{
+			const LoadPhaseBatch& batch = *static_cast<const LoadPhaseBatch*>(context);
+			ScopedMemoryArena worker_arena(batch.arena);
+			run_timed_load_step(batch, (*batch.instances)[index]);
+		}
+
+		void construct_step(Engine& engine, WorkloadInstanceInfo& instance)
+		{
+			if (instance.workload_descriptor->construct_fn)
+				instance.for_each_element(instance.get_ptr(engine), instance.workload_descriptor->construct_fn);
+		}
+
+		void pre_load_step(Engine& engine, WorkloadInstanceInfo& instance)
+		{
+			const WorkloadSeed* seed = instance.seed;
+			const auto* workload_desc = instance.workload_descriptor;
+
+			instance.for_each_element(instance.get_ptr(engine),
+				[&](uint8_t* ptr)
+				{
+					if (workload_desc->set_engine_fn)
+						workload_desc->set_engine_fn(ptr, engine);
+
+					if (seed->config.size() > 0 && workload_desc->config_desc)
+					{
+						ROBOTICK_ASSERT(workload_desc->config_offset != OFFSET_UNBOUND);
+
+						// don't error on first pass - we may need to set some, preload a script to create blackboard, and then have final pass
+						const bool fatalExitIfNotFound = false;
+						DataConnectionUtils::apply_struct_field_values(
+							ptr + workload_desc->config_offset, *workload_desc->config_desc, seed->config, fatalExitIfNotFound);
+					}
+
+					if (workload_desc->pre_load_fn)
+						workload_desc->pre_load_fn(ptr);
+				});
+		}
+
+		void load_step(Engine& engine, WorkloadInstanceInfo& instance)
+		{
+			if (instance.workload_descriptor->load_fn)
+				instance.for_each_element(instance.get_ptr(engine), instance.workload_descriptor->load_fn);
+		}
+
+		void setup_step(Engine& engine, WorkloadInstanceInfo& instance)
+		{
+			if (instance.workload_descriptor->setup_fn)
+				instance.for_each_element(instance.get_ptr(engine), instance.workload_descriptor->setup_fn);
+		}
+
+		// Whether any of the workload's structs holds a Blackboard - known from its type alone, before it is constructed
+		bool has_blackboard_fields(const WorkloadDescriptor& workload_desc)
+		{
+			auto struct_has_blackboard = [](const TypeDescriptor* struct_type)
+			{
+				const StructDescriptor* struct_desc = struct_type ? struct_type->get_struct_desc() : nullptr;
+				if (struct_desc == nullptr)
+					return false;
+
+				for (const FieldDescriptor& field : struct_desc->fields)
+				{
+					if (field.type_id == GET_TYPE_ID(Blackboard))
+						return true;
+				}
+				return false;
+			};
+
+			return struct_has_blackboard(workload_desc.config_desc) || struct_has_blackboard(workload_desc.inputs_desc) ||
+				   struct_has_blackboard(workload_desc.outputs_desc);
+		}
+
+		// Children aren't resolved to instances until after load, so walk the seeds. Returns how many workloads couldn't be bound.
+		size_t bind_subtree_to_numa_node(const Map<const char*, WorkloadInstanceInfo*>& instances_by_unique_name,
+			uint8_t* buffer_ptr,
+			const WorkloadSeed& seed,
+			int numa_node)
+		{
+			size_t failed_count = 0;
+
+			WorkloadInstanceInfo* const* instance = instances_by_unique_name.find(seed.unique_name.c_str());
+			if (instance != nullptr &&
+				!System::bind_memory_to_numa_node(buffer_ptr + (*instance)->offset_in_workloads_buffer, (*instance)->get_size(), numa_node))
+			{
+				failed_count++;
+			}
+
+			for (const WorkloadSeed* child_seed : seed.children)
+			{
+				failed_count += bind_subtree_to_numa_node(instances_by_unique_name, buffer_ptr, *child_seed, numa_node);
+			}
+
+			return failed_count;
+		}
+
+		// Applies each placed subtree's NUMA node to its memory in the final buffer (moving any pages already faulted in). Only a
+		// buffer of its own pages (LockedPages or SharedMemory) is bound - a heap buffer shares its end pages with other allocations.
+		void bind_placements_to_numa_nodes(const HeapVector<WorkloadInstanceInfo>& instances,
+			const Map<const char*, WorkloadInstanceInfo*>& instances_by_unique_name,
+			WorkloadsBuffer& workloads_buffer)
+		{
+			const bool is_page_granular = workloads_buffer.is_mapped() || workloads_buffer.is_shared();
+			uint8_t* buffer_ptr = workloads_buffer.raw_ptr();
+
+			for (const WorkloadInstanceInfo& instance : instances)
+			{
+				const WorkloadPlacementSeed* placement = instance.placement;
+				if (placement == nullptr || placement->numa_node < 0)
+					continue;
+
+				if (!is_page_granular)
+				{
+					ROBOTICK_WARNING("Ignoring NUMA node %d for '%s' - the WorkloadsBuffer is on the heap (allocate it as LockedPages or "
+									 "SharedMemory to place it)",
+						placement->numa_node,
+						placement->workload_name.c_str());
+					continue;
+				}
+
+				const size_t failed_count = bind_subtree_to_numa_node(instances_by_unique_name, buffer_ptr, *instance.seed, placement->numa_node);
+				if (failed_count > 0)
+				{
+					ROBOTICK_WARNING("Could not place %zu workload(s) under '%s' on NUMA node %d - leaving their memory to the OS",
+						failed_count,
+						placement->workload_name.c_str(),
+						placement->numa_node);
+				}
+			}
+		}
+	} // namespace
+
+	// Runs one load-phase callback for every workload - across the worker pool if the model opts in - recording how long each took.
+	// Phases never overlap: run_and_wait() is a barrier, so every workload finishes (e.g.) pre_load before any starts load.
+	void Engine::run_load_phase(const char* phase_name, LoadStepFn load_step, uint64_t WorkloadLoadTimings::*timing_ns)
+	{
+		LoadPhaseBatch batch;
+		batch.engine = this;
+		batch.instances = &state->instances;
+		batch.load_step = load_step;
+		batch.timing_ns = timing_ns;
+		batch.arena = MemoryArena::get_current();
+
+		const size_t instance_count = state->instances.size();
+		const bool is_parallel = state->model->is_parallel_load_enabled() && state->worker_pool.is_running();
+
+		const auto phase_start = Clock::now();
+
+		if (is_parallel)
+		{
+			HeapVector<WorkerTask> tasks;
+			HeapVector<WorkerTask*> task_ptrs;
+			{
+				ScopedMemoryArena scratch_arena(nullptr); // (only needed for this phase - so not kept in the arena until unload)
+				tasks.initialize(instance_count);
+				task_ptrs.initialize(instance_count);
+			}
+
+			for (size_t i = 0; i < instance_count; ++i)
+			{
+				tasks[i].fn = &run_load_step_task;
+				tasks[i].context = &batch;
+				tasks[i].index = static_cast<uint32_t>(i);
+				task_ptrs[i] = &tasks[i];
+			}
+
+			state->worker_pool.run_and_wait(task_ptrs.data(), instance_count);
+		}
+		else
+		{
+			for (WorkloadInstanceInfo& instance : state->instances)
+				run_timed_load_step(batch, instance);
+		}
+
+		const uint64_t phase_ns = Clock::to_nanoseconds(Clock::now() - phase_start).count();
+
+		const WorkloadInstanceInfo* slowest = nullptr;
+		for (const WorkloadInstanceInfo& instance : state->instances)
+		{
+			if (slowest == nullptr || instance.load_timings.*timing_ns > slowest->load_timings.*timing_ns)
+				slowest = &instance;
+		}
+
+		if (slowest != nullptr)
+		{
+			ROBOTICK_INFO("Load phase '%s' took %.2f ms for %zu workloads (%s) - slowest '%s' took %.2f ms",
+				phase_name,
+				phase_ns * 1e-6,
+				instance_count,
+				is_parallel ? "parallel" : "sequential",
+				slowest->seed->unique_name.c_str(),
+				slowest->load_timings.*timing_ns * 1e-6);
+		}
+	}
+
 	void Engine::load(const Model& model)
 	{
 		ROBOTICK_INFO("Loading model: %s", model.get_model_name());
@@ -140,38 +575,61 @@ namespace robotick
 
 		state->model = &model;
 
-		// compute how big we need our workloads-buffer to be:
+		// start the worker pool first, so it can also share out the load phases below:
+		if (model.get_worker_thread_count() > 0)
+			state->worker_pool.start(model.get_worker_thread_count());
+		else if (model.is_parallel_load_enabled())
+			ROBOTICK_WARNING("Parallel load requested for model '%s' without any worker threads - loading sequentially", model.get_model_name());
+
+		// lay out our workloads and their stats, to find how big we need our workloads-buffer to be:
 		const auto* workload_stats_type = TypeRegistry::get().find_by_id(GET_TYPE_ID(WorkloadInstanceStats));
 		ROBOTICK_ASSERT_MSG(workload_stats_type, "Type 'WorkloadInstanceStats' not registered - this should never happen");
 
 		const auto& seeds = model.get_workload_seeds();
-		size_t total_size = 0;
+		HeapVector<WorkloadSlot> slots;
+		size_t total_size = compute_workloads_layout(model, *workload_stats_type, slots);
+
+		// from here on, what the engine and its workloads allocate (until it seals, below) comes from its arena, if the model enables it:
+		ScopedMemoryArena load_arena(model.is_state_arena_enabled() ? &state->arena : nullptr);
+
+		const char* shared_memory_name = model.get_workloads_buffer_shared_memory_name();
+		if (model.get_workloads_buffer_allocation() == WorkloadsBufferAllocation::SharedMemory &&
+			(shared_memory_name == nullptr || shared_memory_name[0] == '\0'))
+			ROBOTICK_FATAL_EXIT("Model '%s' allocates its WorkloadsBuffer as SharedMemory without naming the segment", model.get_model_name());
+
+		// Blackboard storage sits immediately after the workloads, but its size is only known once they've pre-loaded (e.g. scripts
+		// declaring their fields). So a model with blackboards constructs and pre-loads its workloads in a heap buffer holding just
+		// them and their stats, which relocate_workloads_buffer() then moves into one sized exactly (and allocated as the model asks)
+		// - as their types must allow (see is_relocatable_workload). Any other model builds its workloads in place, in the final buffer:
+		bool has_blackboards = false;
+		const WorkloadSeed* unrelocatable_seed = nullptr;
 		for (const WorkloadSeed* seed : seeds)
 		{
-			const auto* workload_type = TypeRegistry::get().find_by_id(seed->type_id);
-			ROBOTICK_ASSERT_MSG(workload_type, "Unknown workload type: %s", seed->type_id.get_debug_name());
-
-			if (!align_workloads_cursor_for_type(*workload_stats_type, total_size))
-				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while sizing stats type '%s'", workload_stats_type->name.c_str());
-			if (!increment_workloads_cursor_for_type(*workload_stats_type, total_size))
-				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while sizing stats type '%s'", workload_stats_type->name.c_str());
+			const TypeDescriptor* workload_type = TypeRegistry::get().find_by_id(seed->type_id);
+			const WorkloadDescriptor* workload_desc = workload_type ? workload_type->get_workload_desc() : nullptr;
+			if (workload_desc == nullptr)
+				continue; // (reported below)
+
+			has_blackboards = has_blackboards || has_blackboard_fields(*workload_desc);
+			if (!workload_desc->is_relocatable && unrelocatable_seed == nullptr)
+				unrelocatable_seed = seed;
+		}
 
-			if (!align_workloads_cursor_for_type(*workload_type, total_size))
-				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow for workload type '%s'", workload_type->name.c_str());
-			if (!increment_workloads_cursor_for_type(*workload_type, total_size))
-				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while sizing workload type '%s'", workload_type->name.c_str());
+		if (has_blackboards && unrelocatable_seed != nullptr)
+		{
+			ROBOTICK_FATAL_EXIT("Workload '%s' isn't relocatable, but model '%s' has blackboards, so its workloads are moved once pre-loaded - "
+								"declare `static constexpr bool is_relocatable = true` if its type keeps no pointers into itself",
+				unrelocatable_seed->unique_name.c_str(),
+				model.get_model_name());
 		}
 
 		// create our workloads-buffer, workload-instances info, and construct each workload:
-		size_t buffer_capacity = 0;
-
-		// Blackboard storage sits immediately after workload instances; reserve it now so the contiguous block never relocates.
-		if (!safe_add_size(total_size, DEFAULT_MAX_BLACKBOARDS_BYTES, buffer_capacity))
-			ROBOTICK_FATAL_EXIT(
-				"Workloads buffer size overflow when reserving blackboard space (%zu + %zu)", total_size, (size_t)DEFAULT_MAX_BLACKBOARDS_BYTES);
-		state->workloads_buffer = WorkloadsBuffer(buffer_capacity);
+		if (has_blackboards)
+			state->workloads_buffer = WorkloadsBuffer(total_size);
+		else
+			state->workloads_buffer = WorkloadsBuffer(total_size, model.get_workloads_buffer_allocation(), shared_memory_name);
 
-		size_t workloads_cursor = 0;
+		size_t workloads_cursor = total_size;
 		uint8_t* buffer_ptr = state->workloads_buffer.raw_ptr();
 		state->instances.initialize(seeds.size());
 
@@ -185,27 +643,14 @@ namespace robotick
 			const auto* workload_desc = workload_type->get_workload_desc();
 			ROBOTICK_ASSERT(workload_desc != nullptr);
 
-			// Stats/instance structs are colocated in the same buffer; align both as if they were independently allocated.
-			if (!align_workloads_cursor_for_type(*workload_stats_type, workloads_cursor))
-				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while laying-out stats for workload type '%s'", workload_type->name.c_str());
-			const size_t stats_offset = workloads_cursor;
-			if (!increment_workloads_cursor_for_type(*workload_stats_type, workloads_cursor))
-				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while laying-out stats for workload type '%s'", workload_type->name.c_str());
-
-			if (!align_workloads_cursor_for_type(*workload_type, workloads_cursor))
-				ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while laying-out workload type '%s'", workload_type->name.c_str());
-			const size_t instance_offset = workloads_cursor;
-			if (!increment_workloads_cursor_for_type(*workload_type, workloads_cursor))
-				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while laying-out workload type '%s'", workload_type->name.c_str());
-
-			uint8_t* workload_stats_ptr = buffer_ptr + stats_offset;
-			uint8_t* workload_ptr = buffer_ptr + instance_offset;
+			uint8_t* workload_stats_ptr = buffer_ptr + slots[i].stats_offset;
 
 			WorkloadInstanceInfo& workload_instance_info = state->instances[i];
-			workload_instance_info.offset_in_workloads_buffer = instance_offset;
+			workload_instance_info.offset_in_workloads_buffer = slots[i].instance_offset;
 			workload_instance_info.type = workload_type;
 			workload_instance_info.workload_descriptor = workload_desc;
 			workload_instance_info.seed = seed;
+			workload_instance_info.instance_count = seed->instance_count;
 
 			// Stats are lifetime-bound to the buffer; placement-new keeps RAII intact without separate allocations.
 			workload_instance_info.workload_stats = new (static_cast<void*>(workload_stats_ptr)) WorkloadInstanceStats{};
@@ -213,48 +658,65 @@ namespace robotick
 
 			// add it to our map for quick lookup by name
 			state->instances_by_unique_name.insert(seed->unique_name.c_str(), &workload_instance_info);
-
-			if (workload_desc->construct_fn)
-			{
-				workload_desc->construct_fn(workload_ptr);
-			}
 		}
 
-		// handle pre-load for each workload (we can multithread this in future, where platforms allow)
+		// and sort them by offset, for notify_input_written() to find the owner of a field:
+		state->instances_by_offset.initialize(seeds.size());
 		for (size_t i = 0; i < seeds.size(); ++i)
-		{
-			const auto& seed = seeds[i];
-			const auto* workload_desc = state->instances[i].workload_descriptor;
-			uint8_t* ptr = buffer_ptr + state->instances[i].offset_in_workloads_buffer;
-
-			if (workload_desc->set_engine_fn)
-				workload_desc->set_engine_fn(ptr, *this);
-
-			if (seed->config.size() > 0 && workload_desc->config_desc)
+			state->instances_by_offset[i] = &state->instances[i];
+		robotick::sort(state->instances_by_offset.begin(),
+			state->instances_by_offset.end(),
+			[](const WorkloadInstanceInfo* lhs, const WorkloadInstanceInfo* rhs)
 			{
-				ROBOTICK_ASSERT(workload_desc->config_offset != OFFSET_UNBOUND);
+				return lhs->offset_in_workloads_buffer < rhs->offset_in_workloads_buffer;
+			});
 
-				// don't error on first pass - we may need to set some, preload a script to create blackboard, and then have final pass
-				const bool fatalExitIfNotFound = false;
-				DataConnectionUtils::apply_struct_field_values(
-					ptr + workload_desc->config_offset, *workload_desc->config_desc, seed->config, fatalExitIfNotFound);
-			}
+		// note each placed workload (whose threads the tick plan sets up), and apply its NUMA hint to the final buffer before
+		// construction fills it (a model with blackboards does so once relocate_workloads_buffer() has moved it there):
+		for (const WorkloadPlacementSeed* placement : model.get_workload_placements())
+		{
+			WorkloadInstanceInfo** placed_instance = state->instances_by_unique_name.find(placement->workload_name.c_str());
+			ROBOTICK_ASSERT_MSG(placed_instance != nullptr, "Placed workload '%s' not found", placement->workload_name.c_str());
+			(*placed_instance)->placement = placement;
+		}
+		if (!has_blackboards)
+			bind_placements_to_numa_nodes(state->instances, state->instances_by_unique_name, state->workloads_buffer);
 
-			if (workload_desc->pre_load_fn)
-				workload_desc->pre_load_fn(ptr);
+		// note each watched workload, whose tick budget the tick plan then carries:
+		for (const WorkloadWatchdogSeed* watchdog : model.get_workload_watchdogs())
+		{
+			WorkloadInstanceInfo** watched_instance = state->instances_by_unique_name.find(watchdog->workload_name.c_str());
+			ROBOTICK_ASSERT_MSG(watched_instance != nullptr, "Watched workload '%s' not found", watchdog->workload_name.c_str());
+			(*watched_instance)->watchdog = watchdog;
 		}
 
+		// construct and pre-load each workload (each phase is shared across the worker pool if the model enables parallel load):
+		run_load_phase("construct", &construct_step, &WorkloadLoadTimings::construct_ns);
+		run_load_phase("pre_load", &pre_load_step, &WorkloadLoadTimings::pre_load_ns);
+
 		// compute our blackboard memory requirements, and bind our blackboards to that memory (they will store buffer-offsets relative to each
 		// Blackboard header):
 		size_t blackboard_size = compute_blackboard_memory_requirements(state->instances);
-		if (blackboard_size > DEFAULT_MAX_BLACKBOARDS_BYTES)
-			ROBOTICK_FATAL_EXIT("Blackboard memory (%zu) exceeds max allowed (%zu)", blackboard_size, DEFAULT_MAX_BLACKBOARDS_BYTES);
+
+		size_t blackboards_start = total_size;
+		if (blackboard_size > 0 && !align_workloads_cursor(BLACKBOARD_STORAGE_ALIGNMENT, blackboards_start))
+			ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow when reserving blackboard space (%zu)", total_size);
+
+		size_t buffer_capacity = 0;
+		if (!safe_add_size(blackboards_start, blackboard_size, buffer_capacity))
+			ROBOTICK_FATAL_EXIT("Workloads buffer size overflow when reserving blackboard space (%zu + %zu)", blackboards_start, blackboard_size);
+
+		// (without blackboards, the workloads were built in the final buffer, which is already the right size)
+		if (has_blackboards)
+			relocate_workloads_buffer(model, buffer_capacity);
+		else
+			ROBOTICK_ASSERT(buffer_capacity == total_size);
 
 		if (blackboard_size > 0)
 		{
-			size_t start = workloads_cursor;
+			size_t start = blackboards_start;
 			size_t next_cursor = 0;
-			if (!safe_add_size(workloads_cursor, blackboard_size, next_cursor))
+			if (!safe_add_size(start, blackboard_size, next_cursor))
 				ROBOTICK_FATAL_EXIT("Workloads buffer overflow while reserving blackboards (%zu + %zu)", start, blackboard_size);
 			workloads_cursor = next_cursor;
 			bind_blackboards_for_instances(state->instances, start);
@@ -262,42 +724,49 @@ namespace robotick
 
 		state->workloads_buffer.set_size_used(workloads_cursor);
 
+		// the layout is final now, so dirty-tracking and readers' copies can be sized to it:
+		if (model.is_dirty_region_tracking_enabled())
+			state->dirty_regions.initialize(state->workloads_buffer, state->workloads_buffer.get_size_used());
+		if (model.is_snapshot_dirty_copy_enabled() && !model.is_dirty_region_tracking_enabled())
+			ROBOTICK_FATAL_EXIT("Model '%s' enables snapshot dirty-copies without dirty-region tracking", model.get_model_name());
+		if (model.get_snapshot_reader_count() > 0)
+		{
+			// (snapshots copy the whole buffer each frame, unless the model opts in to copying just what the tracker marks)
+			const DirtyRegionTracker* dirty_regions = model.is_snapshot_dirty_copy_enabled() ? &state->dirty_regions : nullptr;
+			state->workloads_buffer_snapshots.initialize(state->workloads_buffer, model.get_snapshot_reader_count(), dirty_regions);
+		}
+
 		// post-blackboard-setup config pass:
 		for (size_t i = 0; i < seeds.size(); ++i)
 		{
 			const auto& seed = seeds[i];
 			const auto* workload_desc = state->instances[i].workload_descriptor;
-			uint8_t* ptr = buffer_ptr + state->instances[i].offset_in_workloads_buffer;
 
-			if (seed->config.size() > 0 && workload_desc->config_desc)
-			{
-				ROBOTICK_ASSERT(workload_desc->config_offset != OFFSET_UNBOUND);
+			state->instances[i].for_each_element(state->instances[i].get_ptr(*this),
+				[&](uint8_t* ptr)
+				{
+					if (seed->config.size() > 0 && workload_desc->config_desc)
+					{
+						ROBOTICK_ASSERT(workload_desc->config_offset != OFFSET_UNBOUND);
 
-				const bool fatalExitIfNotFound = true;
-				DataConnectionUtils::apply_struct_field_values(
-					ptr + workload_desc->config_offset, *workload_desc->config_desc, seed->config, fatalExitIfNotFound);
-			}
+						const bool fatalExitIfNotFound = true;
+						DataConnectionUtils::apply_struct_field_values(
+							ptr + workload_desc->config_offset, *workload_desc->config_desc, seed->config, fatalExitIfNotFound);
+					}
 
-			if (seed->inputs.size() > 0 && workload_desc->inputs_desc)
-			{
-				ROBOTICK_ASSERT(workload_desc->inputs_offset != OFFSET_UNBOUND);
+					if (seed->inputs.size() > 0 && workload_desc->inputs_desc)
+					{
+						ROBOTICK_ASSERT(workload_desc->inputs_offset != OFFSET_UNBOUND);
 
-				const bool fatalExitIfNotFound = true;
-				DataConnectionUtils::apply_struct_field_values(
-					ptr + workload_desc->inputs_offset, *workload_desc->inputs_desc, seed->inputs, fatalExitIfNotFound);
-			}
+						const bool fatalExitIfNotFound = true;
+						DataConnectionUtils::apply_struct_field_values(
+							ptr + workload_desc->inputs_offset, *workload_desc->inputs_desc, seed->inputs, fatalExitIfNotFound);
+					}
+				});
 		}
 
-		// handle load for each workload (we can multithread this in future, where platforms allow)
-		for (size_t i = 0; i < state->instances.size(); ++i)
-		{
-			auto& inst = state->instances[i];
-			void* ptr = inst.get_ptr(*this);
-			const auto* workload_desc = state->instances[i].workload_descriptor;
-
-			if (workload_desc->load_fn)
-				workload_desc->load_fn(ptr);
-		}
+		// handle load for each workload:
+		run_load_phase("load", &load_step, &WorkloadLoadTimings::load_ns);
 
 		// hook-up children for each instance:
 		for (size_t i = 0; i < seeds.size(); ++i)
@@ -332,6 +801,14 @@ namespace robotick
 		const WorkloadInstanceInfo* root_instance = find_instance_info(model.get_root_workload()->unique_name.c_str());
 		ROBOTICK_ASSERT(root_instance != nullptr);
 
+		// flatten the workload tree into a contiguous pre-ordered tick plan (children are resolved, so this is now fixed):
+		state->tick_plan.compile(*root_instance, state->instances, state->workloads_buffer);
+		if (state->dirty_regions.is_initialized())
+			state->tick_plan.set_dirty_regions(&state->dirty_regions);
+
+		if (state->worker_pool.is_running())
+			state->tick_plan.set_worker_pool(&state->worker_pool);
+
 		// call set_children_fn - allowing each child to take ownership (responsibility for propagating) each connection
 		{
 			if (root_instance->workload_descriptor->set_children_fn)
@@ -341,6 +818,14 @@ namespace robotick
 			}
 		}
 
+		// let the tick plan claim connections feeding children it sequences itself (i.e. those of workloads without a tick_fn):
+		state->tick_plan.bind_connections(state->data_connections_all);
+
+		if (model.get_tick_scheduling_mode() == TickSchedulingMode::Dataflow)
+			state->tick_plan.build_dataflow_levels();
+		else if (model.get_tick_scheduling_mode() == TickSchedulingMode::Hyperperiod)
+			state->tick_plan.build_hyperperiod_table();
+
 		// allow Engine to acquire data-connections not handled by groups within the model:
 		{
 			// count how many data-connections we need to acquire:
@@ -374,10 +859,30 @@ namespace robotick
 		}
 
 		// call setup() on each instance that has that function
-		for (auto& inst : state->instances)
+		run_load_phase("setup", &setup_step, &WorkloadLoadTimings::setup_ns);
+
+		// bind each enable field (blackboards are laid out by now) to the subtree it switches:
+		const auto& enable_seeds = model.get_workload_enables();
+		state->enable_bindings.initialize(enable_seeds.size());
+		for (size_t i = 0; i < enable_seeds.size(); ++i)
 		{
-			if (inst.workload_descriptor->setup_fn)
-				inst.workload_descriptor->setup_fn(inst.get_ptr(*this));
+			const WorkloadEnableSeed* enable = enable_seeds[i];
+			const char* path = enable->enable_field_path.c_str();
+
+			const FieldInfo field_info = DataConnectionUtils::find_field_info(*this, path);
+			if (field_info.ptr == nullptr)
+				ROBOTICK_FATAL_EXIT("Workload enable error: no field '%s' (for '%s')", path, enable->workload_name.c_str());
+
+			if (field_info.descriptor == nullptr || field_info.descriptor->type_id != GET_TYPE_ID(bool))
+				ROBOTICK_FATAL_EXIT("Workload enable error: field '%s' (for '%s') must be a bool", path, enable->workload_name.c_str());
+
+			const WorkloadInstanceInfo* enabled_instance = find_instance_info(enable->workload_name.c_str());
+			ROBOTICK_ASSERT_MSG(enabled_instance != nullptr, "Enabled workload '%s' not found", enable->workload_name.c_str());
+
+			state->enable_bindings[i].enable_ptr = static_cast<const bool*>(field_info.ptr);
+			state->enable_bindings[i].entry_index = state->tick_plan.find_entry_index(*enabled_instance);
+			if (state->enable_bindings[i].entry_index == TickPlanEntry::INVALID_INDEX)
+				ROBOTICK_FATAL_EXIT("Workload enable error: '%s' is not in the workload tree", enable->workload_name.c_str());
 		}
 
 		ROBOTICK_ASSERT(state->model != nullptr);
@@ -386,10 +891,166 @@ namespace robotick
 
 		state->root_instance = root_instance;
 
+		// readers in other processes find fields via the same layout JSON that TelemetryServer serves:
+		if (state->workloads_buffer.is_shared())
+		{
+			const auto layout_str = build_workloads_buffer_layout_json(*this, nullptr).dump();
+			if (!state->workloads_buffer.publish_shared_layout(layout_str.c_str(), layout_str.size()))
+				ROBOTICK_WARNING("Unable to publish the shared WorkloadsBuffer layout for model '%s'", model.get_model_name());
+		}
+
+		if (model.is_state_arena_enabled())
+		{
+			state->arena.seal();
+			ROBOTICK_INFO("State arena for model '%s': %.1f KB used of %.1f KB reserved (%zu chunks)",
+				model.get_model_name(),
+				state->arena.get_bytes_used() / 1024.0,
+				state->arena.get_bytes_reserved() / 1024.0,
+				state->arena.get_chunk_count());
+		}
+
 		ROBOTICK_INFO("Loading complete for model: %s", model.get_model_name());
 	}
 
 	void Engine::run(const AtomicFlag& stop_after_next_tick_flag)
+	{
+		Clock::time_point next_tick_time = begin_stepped_run(&stop_after_next_tick_flag);
+
+		TickTimer tick_timer;
+		tick_timer.start(state->model->get_tick_timer_backend());
+
+		do
+		{
+			// cut short by the stop flag (or stop()), so stopping never waits out the rest of a (possibly long) period:
+			if (tick_timer.sleep_until_or_woken(next_tick_time, stop_after_next_tick_flag))
+				next_tick_time = step();
+
+		} while (!stop_after_next_tick_flag.is_set() && !should_exit_application() && !is_stop_requested());
+
+		end_stepped_run();
+	}
+
+	Clock::time_point Engine::begin_stepped_run(const AtomicFlag* wake_flag)
+	{
+		const float root_tick_rate_hz = begin_run();
+		{
+			LockGuard lock(state->stop_mutex);
+			state->run_wake_flag.store(wake_flag);
+		}
+
+		State::SteppedRun& run_state = state->stepped_run;
+		run_state.tick_interval = Clock::from_seconds(1.0f / root_tick_rate_hz);
+		run_state.overrun_policy = state->model->get_overrun_policy();
+		run_state.budget_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(run_state.tick_interval).count());
+
+		// start one interval in the past, so the first tick is due now and its delta is one tick-interval:
+		const auto now = Clock::now();
+		run_state.start_time = now - run_state.tick_interval;
+		run_state.last_tick_time = run_state.start_time;
+		run_state.next_tick_time = now;
+
+		// TickInfo is reused every step; we update its running clock/delta fields so consumers never see partially
+		// initialized values.
+		run_state.tick_info = TickInfo();
+		run_state.tick_info.workload_stats = state->root_instance->workload_stats;
+		run_state.tick_info.tick_rate_hz = root_tick_rate_hz;
+
+		return run_state.next_tick_time;
+	}
+
+	Clock::time_point Engine::step()
+	{
+		if (!state->is_running.is_set())
+			ROBOTICK_FATAL_EXIT("Engine::step() called without begin_stepped_run() for model: %s", get_model_name());
+
+		State::SteppedRun& run_state = state->stepped_run;
+		WorkloadInstanceStats* root_stats = state->root_instance->workload_stats;
+
+		const auto now = Clock::now();
+		const auto ns_since_start = Clock::to_nanoseconds(now - run_state.start_time).count();
+		const auto ns_since_last = Clock::to_nanoseconds(now - run_state.last_tick_time).count();
+		const auto ns_late = Clock::to_nanoseconds(now - run_state.next_tick_time).count();
+
+		root_stats->record_wake_jitter(ns_late > 0 ? detail::clamp_to_uint32(ns_late) : 0);
+
+		constexpr float s_1_nanosecond_sec = 1e-9F;
+
+		TickInfo& tick_info = run_state.tick_info;
+		tick_info.tick_count += 1;
+		tick_info.time_now_ns = ns_since_start;
+		tick_info.time_now = ns_since_start * s_1_nanosecond_sec;
+		tick_info.delta_time = ns_since_last * s_1_nanosecond_sec;
+
+		run_state.last_tick_time = now;
+
+		tick_frame(tick_info, detail::clamp_to_uint32(ns_since_last), run_state.budget_ns);
+
+		const auto now_post = Clock::now();
+
+		run_state.next_tick_time += run_state.tick_interval;
+
+		if (now_post > run_state.next_tick_time)
+		{
+			root_stats->missed_deadline_count++;
+
+			switch (run_state.overrun_policy)
+			{
+			case OverrunPolicy::CatchUp:
+				break; // the following ticks run back-to-back until we're back on schedule
+			case OverrunPolicy::SkipAndRealign:
+			{
+				// advance by whole intervals so we keep the original phase, landing on the first slot still ahead of us:
+				const auto missed_intervals = (now_post - run_state.next_tick_time) / run_state.tick_interval;
+				run_state.next_tick_time += run_state.tick_interval * (missed_intervals + 1);
+				break;
+			}
+			case OverrunPolicy::StretchPeriod:
+				run_state.next_tick_time = now_post;
+				break;
+			}
+		}
+
+		return run_state.next_tick_time;
+	}
+
+	void Engine::end_stepped_run()
+	{
+		finish_run();
+	}
+
+	void Engine::run_virtual_time(const AtomicFlag& stop_after_next_tick_flag, uint64_t max_ticks)
+	{
+		const float root_tick_rate_hz = begin_run();
+		const auto& root_info = *(state->root_instance);
+
+		// whole nanoseconds, so time_now_ns is an exact multiple of the period and identical on every run:
+		const uint64_t period_ns = static_cast<uint64_t>(1e9 / root_tick_rate_hz + 0.5);
+		const uint32_t budget_ns = detail::clamp_to_uint32(period_ns);
+
+		constexpr float s_1_nanosecond_sec = 1e-9F;
+
+		TickInfo tick_info;
+		tick_info.workload_stats = root_info.workload_stats;
+		tick_info.tick_rate_hz = root_tick_rate_hz;
+		tick_info.delta_time = period_ns * s_1_nanosecond_sec;
+
+		do
+		{
+			// matches run(), whose first tick also lands one interval after the (virtual) start:
+			tick_info.tick_count += 1;
+			tick_info.time_now_ns = tick_info.tick_count * period_ns;
+			tick_info.time_now = tick_info.time_now_ns * s_1_nanosecond_sec;
+
+			tick_frame(tick_info, budget_ns, budget_ns);
+
+			// no sleeping - the next tick starts as soon as this one is done
+		} while (!stop_after_next_tick_flag.is_set() && !should_exit_application() && !is_stop_requested() &&
+				 (max_ticks == 0 || tick_info.tick_count < max_ticks));
+
+		finish_run();
+	}
+
+	float Engine::begin_run()
 	{
 		ROBOTICK_INFO("Running model: %s", state->model->get_model_name());
 
@@ -406,104 +1067,216 @@ namespace robotick
 		if (root_tick_rate_hz <= 0.0)
 			ROBOTICK_FATAL_EXIT("Root workload must have valid tick_rate_hz>0.0 - check your model settings");
 
-		const auto root_tick_fn = root_info.workload_descriptor->tick_fn;
-		if (root_tick_fn == nullptr)
-			ROBOTICK_FATAL_EXIT("Root workload must have valid tick_fn - check it has been correctly registered");
+		// a root without a tick_fn is sequenced by the tick plan, which then needs children to tick:
+		if (root_info.workload_descriptor->tick_fn == nullptr && root_info.children.size() == 0)
+			ROBOTICK_FATAL_EXIT("Root workload must have valid tick_fn or children - check it has been correctly registered");
+
+		// pin the thread running the engine, if the model places the root:
+		if (root_info.placement != nullptr && root_info.placement->core >= 0)
+			Thread::set_affinity(root_info.placement->core);
 
 		// start_fn always runs on the same thread that will perform ticks so workloads can safely cache thread-affine handles.
 		if (root_info.workload_descriptor->start_fn)
 			root_info.workload_descriptor->start_fn(root_ptr, root_tick_rate_hz);
 
-		state->telemetry_server.start(*this, state->model->get_telemetry_port());
+		{
+			LockGuard lock(state->stop_mutex);
+			state->has_run_finished.clear();
+		}
 
-		state->is_running = true;
+		state->tick_plan.start();
 
-		const auto child_tick_interval = Clock::from_seconds(1.0f / root_tick_rate_hz);
-		const auto engine_start_time = Clock::now() - child_tick_interval;
-		// ^- subtract tick-interval so initial delta is from tick-interval
+		// police the budgets of any watched workloads (a no-op if there are none):
+		state->watchdog.start(state->tick_plan);
 
-		auto last_tick_time = engine_start_time;
-		auto next_tick_time = engine_start_time;
+		state->telemetry_server.start(*this, state->model->get_telemetry_port());
 
-		// TickInfo is reused every iteration; we update its running clock/delta fields so consumers never see partially
-		// initialized values.
-		TickInfo tick_info;
-		tick_info.workload_stats = root_info.workload_stats;
-		tick_info.tick_rate_hz = root_tick_rate_hz;
+		state->is_running.set();
 
-		do
-		{
-			const auto now = Clock::now();
-			const auto ns_since_start = Clock::to_nanoseconds(now - engine_start_time).count();
-			const auto ns_since_last = Clock::to_nanoseconds(now - last_tick_time).count();
+		return root_tick_rate_hz;
+	}
 
-			constexpr float s_1_nanosecond_sec = 1e-9F;
+	void Engine::tick_frame(const TickInfo& tick_info, uint32_t delta_ns, uint32_t budget_ns)
+	{
+		const auto tick_start = Clock::now();
 
-			tick_info.tick_count += 1;
-			tick_info.time_now_ns = ns_since_start;
-			tick_info.time_now = ns_since_start * s_1_nanosecond_sec;
-			tick_info.delta_time = ns_since_last * s_1_nanosecond_sec;
+		// Open the seqlock window before mutating workload memory so telemetry readers can detect "write in progress" (odd seq).
+		state->workloads_buffer.mark_frame_write_begin();
 
-			last_tick_time = now;
+		// start this frame's dirty-tracking afresh (a no-op unless enabled)
+		state->dirty_regions.clear();
 
-			// Open the seqlock window before mutating workload memory so telemetry readers can detect "write in progress" (odd seq).
-			state->workloads_buffer.mark_frame_write_begin();
+		// wake async workloads whose watched fds have become ready (one non-blocking poll for all of them)
+		if (state->io_reactor.get_watch_count() > 0)
+		{
+			state->io_reactor.poll(
+				[](void* context, const void* owner_ptr)
+				{
+					static_cast<const Engine*>(context)->notify_input_written(owner_ptr);
+				},
+				this);
+		}
 
-			// update remote data-connections
-			state->remote_engine_connections.tick(tick_info);
+		// take in remote data-connections (their outgoing side is sent after the tick, below)
+		state->remote_engine_connections.tick_receive(tick_info);
 
-			// update local data-connections
-			for (const DataConnectionInfo* data_connection : state->data_connections_acquired)
+		// update local data-connections (noting those that change an event-driven workload's inputs, or a tracked region)
+		const bool is_tracking_dirty = state->dirty_regions.is_initialized();
+		for (const DataConnectionInfo* data_connection : state->data_connections_acquired)
+		{
+			const WorkloadInstanceInfo* dest_workload = data_connection->dest_workload;
+			const bool is_event_driven = dest_workload && dest_workload->workload_descriptor->is_event_driven;
+			if (is_event_driven || is_tracking_dirty)
+			{
+				if (data_connection->do_data_copy_if_changed())
+				{
+					if (is_event_driven)
+						state->tick_plan.mark_event(state->tick_plan.find_entry_index(*dest_workload));
+					state->dirty_regions.mark_dirty(data_connection->dest_ptr, data_connection->size);
+				}
+			}
+			else
 			{
 				data_connection->do_data_copy();
 			}
+		}
+
+		// Apply pending telemetry-originated input writes after connection propagation and before tick.
+		state->telemetry_server.apply_pending_input_writes();
 
-			// Apply pending telemetry-originated input writes after connection propagation and before tick.
-			state->telemetry_server.apply_pending_input_writes();
+		// switch subtrees on/off from their enable fields, now they hold this frame's values:
+		for (const State::EnableBinding& enable_binding : state->enable_bindings)
+			state->tick_plan.set_entry_enabled(enable_binding.entry_index, *enable_binding.enable_ptr);
 
-			// Ensure all published data writes are visible before workloads read them (cross-thread barrier via Atomic helpers)
-			thread_fence_release();
+		// Ensure all published data writes are visible before workloads read them (cross-thread barrier via Atomic helpers)
+		thread_fence_release();
 
-			root_tick_fn(root_ptr, tick_info);
+		state->tick_plan.tick_root(tick_info);
 
-			const auto now_post = Clock::now();
-			const uint32_t duration_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(now_post - now).count());
-			const uint64_t budget_ns_raw = Clock::to_nanoseconds(child_tick_interval).count();
-			const uint32_t budget_ns = detail::clamp_to_uint32(budget_ns_raw);
+		const uint32_t duration_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(Clock::now() - tick_start).count());
 
-			const uint32_t clamped_delta_ns = detail::clamp_to_uint32(ns_since_last);
+		// Update the per-workload stats in-place so telemetry can report overruns without introducing dynamic allocations.
+		WorkloadInstanceStats* root_stats = state->root_instance->workload_stats;
+		root_stats->record_tick_sample(duration_ns, delta_ns, budget_ns);
+		root_stats->tick_count++;
+		state->dirty_regions.mark_dirty(root_stats, sizeof(WorkloadInstanceStats));
 
-			// Update the per-workload stats in-place so telemetry can report overruns without introducing dynamic allocations.
-			root_info.workload_stats->record_tick_sample(duration_ns, clamped_delta_ns, budget_ns);
-			root_info.workload_stats->tick_count++;
+		// Close the seqlock window after all tick writes so telemetry readers can treat this frame as stable (even seq).
+		state->workloads_buffer.mark_frame_write_end();
 
-			// Close the seqlock window after all tick writes so telemetry readers can treat this frame as stable (even seq).
-			state->workloads_buffer.mark_frame_write_end();
+		// send this tick's outputs to remote engines now, rather than a whole tick-period later at the start of the next frame
+		state->remote_engine_connections.tick_send();
 
-			next_tick_time += child_tick_interval;
-			Thread::hybrid_sleep_until(next_tick_time);
+		// then publish the finished frame for other threads to read (skipped, rather than waited on, if every copy is in use)
+		if (state->workloads_buffer_snapshots.is_initialized())
+			state->workloads_buffer_snapshots.publish(state->workloads_buffer);
 
-		} while (!stop_after_next_tick_flag.is_set() && !should_exit_application());
+		// and hand it to a save_checkpoint() waiting on it - which writes it out on its own thread, not ours
+		if (state->checkpoint_requested.is_set())
+		{
+			LockGuard lock(state->checkpoint_mutex);
+			if (state->checkpoint_requested.is_set())
+			{
+				state->checkpoint.capture(state->workloads_buffer);
+				state->checkpoint_requested.clear();
+			}
+			state->checkpoint_captured.notify_all();
+		}
+	}
 
+	void Engine::finish_run()
+	{
 		ROBOTICK_INFO("Engine stopping for model: %s", state->model->get_model_name());
 
-		state->is_running = false;
+		state->is_running.clear();
+
+		// dedicated threads finish any tick in flight before anything is stopped:
+		state->tick_plan.stop();
+		state->watchdog.stop();
 
 		for (auto& inst : state->instances)
 		{
 			if (inst.workload_descriptor->stop_fn)
-				inst.workload_descriptor->stop_fn(inst.get_ptr(*this));
+				inst.for_each_element(inst.get_ptr(*this), inst.workload_descriptor->stop_fn);
 		}
 
 		state->remote_engine_connections.stop();
 		state->telemetry_server.stop();
 
 		ROBOTICK_INFO("Engine stopped for model: %s", state->model->get_model_name());
+
+		LockGuard lock(state->stop_mutex);
+		state->run_wake_flag.store(nullptr);
+		state->stop_requested.clear();
+		state->has_run_finished.set();
 	}
 
 	bool Engine::is_running() const
 	{
-		return state->is_running;
+		return state->is_running.is_set();
+	}
+
+	bool Engine::save_checkpoint(const char* path)
+	{
+		ROBOTICK_ASSERT_MSG(state->model != nullptr, "Engine::save_checkpoint() - engine has not been loaded");
+
+		UniqueLock lock(state->checkpoint_mutex);
+		if (!state->checkpoint.is_initialized())
+			state->checkpoint.initialize(*this);
+
+		state->checkpoint_requested.set();
+		while (state->checkpoint_requested.is_set() && is_running())
+			state->checkpoint_captured.wait_for(lock, std_approved::chrono::milliseconds(10));
+
+		// (not running - or it stopped before finishing another frame - so there's no frame in progress to wait for)
+		if (state->checkpoint_requested.is_set())
+		{
+			state->checkpoint.capture(state->workloads_buffer);
+			state->checkpoint_requested.clear();
+		}
+
+		return state->checkpoint.save(path);
+	}
+
+	bool Engine::restore_checkpoint(const char* path)
+	{
+		ROBOTICK_ASSERT_MSG(state->model != nullptr, "Engine::restore_checkpoint() - engine has not been loaded");
+		if (is_running())
+			ROBOTICK_FATAL_EXIT("Engine::restore_checkpoint() - cannot restore while running (model '%s')", get_model_name());
+
+		LockGuard lock(state->checkpoint_mutex);
+		if (!state->checkpoint.is_initialized())
+			state->checkpoint.initialize(*this);
+
+		if (!state->checkpoint.load(path))
+			return false;
+
+		state->checkpoint.apply(state->workloads_buffer);
+		ROBOTICK_INFO("Restored checkpoint '%s' for model: %s", path, get_model_name());
+		return true;
+	}
+
+	bool Engine::is_stop_requested() const
+	{
+		return state->stop_requested.is_set() || state->watchdog.is_stop_requested();
+	}
+
+	bool Engine::stop(Clock::duration timeout)
+	{
+		{
+			LockGuard lock(state->stop_mutex);
+			state->stop_requested.set();
+
+			// (nothing running - the request stops the next run instead, after its first tick)
+			if (state->has_run_finished.is_set())
+				return true;
+
+			const AtomicFlag* wake_flag = state->run_wake_flag.load();
+			if (wake_flag != nullptr)
+				wake_flag->wake_waiters();
+		}
+
+		return state->has_run_finished.wait_until(Clock::now() + timeout);
 	}
 
 	const char* Engine::get_model_name() const
@@ -553,6 +1326,103 @@ namespace robotick
 		return state->workloads_buffer;
 	}
 
+	TickPlan& Engine::get_tick_plan() const
+	{
+		return state->tick_plan;
+	}
+
+	WorkloadsBufferSnapshots& Engine::get_workloads_buffer_snapshots() const
+	{
+		return state->workloads_buffer_snapshots;
+	}
+
+	DirtyRegionTracker& Engine::get_dirty_regions() const
+	{
+		return state->dirty_regions;
+	}
+
+	const MemoryArena& Engine::get_state_arena() const
+	{
+		return state->arena;
+	}
+
+	IoReactor& Engine::get_io_reactor() const
+	{
+		return state->io_reactor;
+	}
+
+	Watchdog& Engine::get_watchdog() const
+	{
+		return state->watchdog;
+	}
+
+	WorkerPool* Engine::get_worker_pool() const
+	{
+		return state->worker_pool.is_running() ? &state->worker_pool : nullptr;
+	}
+
+	void Engine::notify_input_written(const void* field_ptr) const
+	{
+		const uint8_t* buffer_begin = state->workloads_buffer.raw_ptr();
+		const uint8_t* field = static_cast<const uint8_t*>(field_ptr);
+		if (field == nullptr || buffer_begin == nullptr || field < buffer_begin)
+			return;
+
+		const size_t offset = static_cast<size_t>(field - buffer_begin);
+
+		// find the last instance (in ascending offset order) starting at or before the field:
+		const HeapVector<const WorkloadInstanceInfo*>& instances = state->instances_by_offset;
+		size_t low = 0;
+		size_t high = instances.size();
+		while (low < high)
+		{
+			const size_t mid = low + (high - low) / 2;
+			if (instances[mid]->offset_in_workloads_buffer <= offset)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+
+		if (low == 0)
+			return;
+
+		const WorkloadInstanceInfo& owner = *instances[low - 1];
+		if (offset >= owner.offset_in_workloads_buffer + owner.get_size())
+			return; // e.g. a stats block or blackboard storage, rather than the workload itself
+
+		state->tick_plan.mark_event(state->tick_plan.find_entry_index(owner));
+	}
+
+	// Moves the constructed (and pre-loaded) workloads and their stats into a buffer of buffer_capacity, allocated as the model asks.
+	// load() has already refused any workload type that isn't relocatable (see is_relocatable_workload), so until load() nothing
+	// outside the buffer holds pointers into it, bar the stats pointers and IoReactor watch owners (rebased here) - the bytes move
+	// as-is, much as a mirror copies them, and the old buffer is freed without destroying anything in it. (Blackboards binding
+	// fields held in the buffer are refused by compute_blackboard_memory_requirements(), which runs first.)
+	void Engine::relocate_workloads_buffer(const Model& model, const size_t buffer_capacity)
+	{
+		WorkloadsBuffer staging_buffer = robotick::move(state->workloads_buffer);
+		ROBOTICK_ASSERT(buffer_capacity >= staging_buffer.get_size());
+
+		state->workloads_buffer =
+			WorkloadsBuffer(buffer_capacity, model.get_workloads_buffer_allocation(), model.get_workloads_buffer_shared_memory_name());
+
+		uint8_t* buffer_ptr = state->workloads_buffer.raw_ptr();
+		const uint8_t* staging_ptr = staging_buffer.raw_ptr();
+
+		// place the new memory before the copy fills it:
+		bind_placements_to_numa_nodes(state->instances, state->instances_by_unique_name, state->workloads_buffer);
+		::memcpy(buffer_ptr, staging_ptr, staging_buffer.get_size());
+
+		for (WorkloadInstanceInfo& instance : state->instances)
+		{
+			const size_t stats_offset = reinterpret_cast<const uint8_t*>(instance.workload_stats) - staging_ptr;
+			instance.workload_stats = robotick::launder(reinterpret_cast<WorkloadInstanceStats*>(buffer_ptr + stats_offset));
+		}
+
+		// (async workloads may already have watched their fds, from construct or pre_load)
+		state->io_reactor.rebase_owners(staging_ptr, staging_buffer.get_size(), buffer_ptr);
+	}
+
 	size_t Engine::compute_blackboard_memory_requirements(const HeapVector<WorkloadInstanceInfo>& instances)
 	{
 		size_t total = 0;
@@ -584,11 +1454,26 @@ namespace robotick
 					{
 						ROBOTICK_ASSERT(field.offset_within_container != OFFSET_UNBOUND);
 
+						if (instance.instance_count > 1)
+							ROBOTICK_FATAL_EXIT("Instanced workload '%s' cannot have Blackboard fields", instance.seed->unique_name.c_str());
+
 						const Blackboard& blackboard =
 							field.get_data<Blackboard>(state->workloads_buffer, instance, *struct_type_desc, struct_offset);
+
+						// the buffer is relocated once we know its size, which would leave these fields dangling:
+						const uint8_t* fields_ptr = reinterpret_cast<const uint8_t*>(blackboard.get_struct_descriptor().fields.begin());
+						const uint8_t* buffer_begin = state->workloads_buffer.raw_ptr();
+						if (fields_ptr >= buffer_begin && fields_ptr < buffer_begin + state->workloads_buffer.get_size())
+						{
+							ROBOTICK_FATAL_EXIT("Workload '%s' binds Blackboard '%s' to fields held within the workloads buffer, which is "
+												"relocated after pre_load - keep them in State<> or static storage instead",
+								instance.seed->unique_name.c_str(),
+								field.name.c_str());
+						}
+
 						size_t next_total = 0;
 						size_t block_size = blackboard.get_info().total_datablock_size;
-						if (!safe_add_size(total, block_size, next_total))
+						if (!align_workloads_cursor(BLACKBOARD_STORAGE_ALIGNMENT, total) || !safe_add_size(total, block_size, next_total))
 						{
 							const char* instance_name =
 								(instance.seed && instance.seed->unique_name.c_str()) ? instance.seed->unique_name.c_str() : "unknown";
@@ -617,6 +1502,8 @@ namespace robotick
 			if (field.type_id == GET_TYPE_ID(Blackboard))
 			{
 				Blackboard& blackboard = field.get_data<Blackboard>(state->workloads_buffer, instance, struct_type_desc, struct_offset);
+				if (!align_workloads_cursor(BLACKBOARD_STORAGE_ALIGNMENT, blackboard_storage_offset))
+					ROBOTICK_FATAL_EXIT("Workloads buffer alignment overflow while binding blackboards for '%s'", instance.seed->unique_name.c_str());
 				blackboard.bind(state->workloads_buffer, blackboard_storage_offset);
 			}
 		}
@@ -635,7 +1522,12 @@ namespace robotick
 			if (workload_desc->inputs_desc)
 				bind_blackboards_in_struct(instance, *workload_desc->inputs_desc, workload_desc->inputs_offset, start_offset);
 			if (workload_desc->outputs_desc)
+			{
+				// note where its outputs' storage went, for DirtyRegionTracker to mark whenever it ticks:
+				instance.outputs_storage_offset = start_offset;
 				bind_blackboards_in_struct(instance, *workload_desc->outputs_desc, workload_desc->outputs_offset, start_offset);
+				instance.outputs_storage_size = start_offset - instance.outputs_storage_offset;
+			}
 		}
 	}
 
@@ -24,6 +24,11 @@ namespace robotick
 	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, duration_window_index)
 	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, delta_window_index)
 	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, overrun_count)
+	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, missed_deadline_count)
+	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, last_wake_jitter_ns)
+	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, max_wake_jitter_ns)
+	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint32_t, watchdog_trip_count)
+	ROBOTICK_STRUCT_FIELD(WorkloadInstanceStats, uint64_t, skipped_tick_count)
 	ROBOTICK_REGISTER_STRUCT_END(WorkloadInstanceStats)
 
 	uint8_t* WorkloadInstanceInfo::get_ptr(const Engine& engine) const
@@ -37,10 +42,20 @@ namespace robotick
 
 		uint8_t* ptr = workloads_buffer.raw_ptr() + this->offset_in_workloads_buffer;
 
-		ROBOTICK_ASSERT(workloads_buffer.contains_object(ptr, this->type->size) &&
+		ROBOTICK_ASSERT(workloads_buffer.contains_object(ptr, get_size()) &&
 						"WorkloadInstanceInfo computed should be within the workloads-buffer provided");
 
 		return ptr;
 	}
 
+	size_t WorkloadInstanceInfo::get_size() const
+	{
+		return this->type->size * this->instance_count;
+	}
+
+	size_t WorkloadInstanceInfo::get_element_size() const
+	{
+		return this->type->size;
+	}
+
 } // namespace robotick
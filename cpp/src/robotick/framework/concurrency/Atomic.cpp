@@ -0,0 +1,97 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/Atomic.h"
+
+#include "robotick/framework/concurrency/Thread.h"
+
+#include <climits>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace robotick
+{
+#if defined(__linux__)
+	namespace
+	{
+		static_assert(sizeof(std_approved::atomic<uint32_t>) == sizeof(uint32_t), "AtomicFlag's word must be futex-sized");
+
+		uint32_t* get_futex_word(std_approved::atomic<uint32_t>& flag)
+		{
+			return reinterpret_cast<uint32_t*>(&flag);
+		}
+
+		// steady_clock is CLOCK_MONOTONIC on Linux - the clock FUTEX_WAIT_BITSET takes absolute deadlines on by default
+		timespec to_monotonic_timespec(Clock::time_point time_point)
+		{
+			const int64_t ns = Clock::to_nanoseconds(time_point.time_since_epoch()).count();
+			timespec result{};
+			result.tv_sec = static_cast<time_t>(ns / 1000000000);
+			result.tv_nsec = static_cast<long>(ns % 1000000000);
+			return result;
+		}
+	} // namespace
+
+	bool AtomicFlag::wait_until(Clock::time_point deadline) const
+	{
+		uint32_t expected = flag.load();
+		const uint32_t wake_count = expected & ~(SET_BIT | WAITING_BIT);
+
+		while ((expected & SET_BIT) == 0 && (expected & ~(SET_BIT | WAITING_BIT)) == wake_count)
+		{
+			if (Clock::now() >= deadline)
+				break;
+
+			// announce ourselves first, so that set() knows to wake us:
+			if ((expected & WAITING_BIT) == 0)
+			{
+				if (!flag.compare_exchange_weak(expected, expected | WAITING_BIT))
+					continue;
+				expected |= WAITING_BIT;
+			}
+
+			// sleeps only while the word still holds `expected` - so a set() or wake between our load and here isn't lost:
+			const timespec timeout = to_monotonic_timespec(deadline);
+			const long result = ::syscall(
+				SYS_futex, get_futex_word(flag), FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, expected, &timeout, nullptr, FUTEX_BITSET_MATCH_ANY);
+			if (result != 0 && errno == ETIMEDOUT)
+				break;
+
+			expected = flag.load();
+		}
+
+		return is_set();
+	}
+
+	void AtomicFlag::wake_waiters() const
+	{
+		flag.fetch_add(WAKE_COUNT_ONE);
+		::syscall(SYS_futex, get_futex_word(flag), FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX, nullptr, nullptr, 0);
+	}
+
+#else // no futex - poll instead, bounding the wake latency to about a millisecond
+
+	bool AtomicFlag::wait_until(Clock::time_point deadline) const
+	{
+		const uint32_t wake_count = flag.load() & ~(SET_BIT | WAITING_BIT);
+
+		while (!is_set() && (flag.load() & ~(SET_BIT | WAITING_BIT)) == wake_count && Clock::now() < deadline)
+			Thread::sleep_ms(1);
+
+		return is_set();
+	}
+
+	void AtomicFlag::wake_waiters() const
+	{
+		flag.fetch_add(WAKE_COUNT_ONE);
+	}
+
+#endif
+
+} // namespace robotick
@@ -0,0 +1,249 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/WorkerPool.h"
+
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/concurrency/WorkStealingDeque.h"
+
+#include <stdio.h>
+
+namespace robotick
+{
+	namespace
+	{
+		// number of empty find_task() rounds a worker yields through before parking on the condition variable:
+		constexpr uint32_t IDLE_YIELDS_BEFORE_PARKING = 64;
+
+		constexpr uint32_t EXTERNAL_QUEUE_INDEX = 0;
+		constexpr uint32_t NOT_A_WORKER = 0xFFFFFFFFu;
+
+		// lets run_and_wait() find the calling thread's own queue (and recognise non-worker callers):
+		thread_local const WorkerPool* current_pool = nullptr;
+		thread_local uint32_t current_queue_index = NOT_A_WORKER;
+	} // namespace
+
+	struct WorkerPool::Worker
+	{
+		WorkStealingDeque<WorkerTask*, DEFAULT_WORKER_QUEUE_CAPACITY> queue;
+		WorkerPool* pool = nullptr;
+		uint32_t queue_index = 0;
+		Thread thread;
+	};
+
+	WorkerPool::~WorkerPool()
+	{
+		stop();
+	}
+
+	void WorkerPool::start(uint32_t in_worker_thread_count)
+	{
+		if (is_running())
+			ROBOTICK_FATAL_EXIT("WorkerPool::start() called while already running");
+
+		if (in_worker_thread_count == 0)
+			return;
+
+		if (in_worker_thread_count > DEFAULT_MAX_WORKER_THREADS)
+		{
+			ROBOTICK_WARNING("WorkerPool: clamping %u requested worker threads to %u", in_worker_thread_count, DEFAULT_MAX_WORKER_THREADS);
+			in_worker_thread_count = DEFAULT_MAX_WORKER_THREADS;
+		}
+
+		worker_thread_count = in_worker_thread_count;
+		stopping.clear();
+		exited_workers.store(0);
+
+		// array-new (rather than HeapVector) so the queues' cache-line alignment is honoured
+		workers = new Worker[worker_thread_count + 1];
+
+		for (uint32_t queue_index = 0; queue_index <= worker_thread_count; ++queue_index)
+		{
+			workers[queue_index].pool = this;
+			workers[queue_index].queue_index = queue_index;
+		}
+
+		for (uint32_t queue_index = 1; queue_index <= worker_thread_count; ++queue_index)
+		{
+			char thread_name[16];
+			::snprintf(thread_name, sizeof(thread_name), "robotick-wkr%u", queue_index);
+			workers[queue_index].thread = Thread(&WorkerPool::worker_thread_entry, &workers[queue_index], thread_name);
+		}
+	}
+
+	void WorkerPool::stop()
+	{
+		if (!is_running())
+			return;
+
+		stopping.set();
+		wake_parked_workers();
+
+		for (uint32_t queue_index = 1; queue_index <= worker_thread_count; ++queue_index)
+		{
+			Thread& thread = workers[queue_index].thread;
+			if (thread.is_joining_supported() && thread.is_joinable())
+				thread.join();
+		}
+
+		// platforms without join support (e.g. FreeRTOS tasks) signal their exit instead:
+		while (exited_workers.load() < worker_thread_count)
+		{
+			Thread::sleep_ms(1);
+		}
+
+		delete[] workers;
+		workers = nullptr;
+		worker_thread_count = 0;
+	}
+
+	void WorkerPool::worker_thread_entry(void* arg)
+	{
+		Worker* worker = static_cast<Worker*>(arg);
+		worker->pool->worker_loop(worker->queue_index);
+	}
+
+	void WorkerPool::worker_loop(uint32_t queue_index)
+	{
+		current_pool = this;
+		current_queue_index = queue_index;
+
+		uint32_t idle_yields = 0;
+
+		while (!stopping.is_set())
+		{
+			// sample the epoch before looking for work, so a batch submitted after an empty search is never slept through:
+			const uint32_t observed_epoch = work_epoch.load();
+
+			WorkerTask* task = nullptr;
+			if (find_task(queue_index, task))
+			{
+				execute_task(*task);
+				idle_yields = 0;
+				continue;
+			}
+
+			if (idle_yields < IDLE_YIELDS_BEFORE_PARKING)
+			{
+				idle_yields++;
+				Thread::yield();
+				continue;
+			}
+
+			idle_yields = 0;
+
+			UniqueLock lock(park_mutex);
+			parked_workers.fetch_add(1);
+			park_condition.wait(lock, [&]() { return stopping.is_set() || work_epoch.load() != observed_epoch; });
+			parked_workers.fetch_sub(1);
+		}
+
+		current_pool = nullptr;
+		current_queue_index = NOT_A_WORKER;
+
+		exited_workers.fetch_add(1);
+	}
+
+	bool WorkerPool::find_task(uint32_t queue_index, WorkerTask*& out_task)
+	{
+		if (workers[queue_index].queue.pop(out_task))
+			return true;
+
+		// steal round-robin, starting just after ourselves so thieves spread across victims:
+		const uint32_t queue_count = worker_thread_count + 1;
+		for (uint32_t offset = 1; offset < queue_count; ++offset)
+		{
+			const uint32_t victim_index = (queue_index + offset) % queue_count;
+			if (workers[victim_index].queue.steal(out_task))
+				return true;
+		}
+
+		return false;
+	}
+
+	void WorkerPool::execute_task(WorkerTask& task)
+	{
+		AtomicValue<uint32_t>* pending_count = task.pending_count;
+		task.fn(task.context, task.index);
+
+		// release so the submitter observes everything this task wrote once it sees the batch complete
+		pending_count->fetch_sub(1, std_approved::memory_order_release);
+	}
+
+	void WorkerPool::wake_parked_workers()
+	{
+		// taking the lock orders us after any worker that has checked its wait-predicate but not yet started waiting
+		{
+			LockGuard lock(park_mutex);
+		}
+		park_condition.notify_all();
+	}
+
+	void WorkerPool::run_and_wait(WorkerTask* const* tasks, size_t task_count)
+	{
+		if (task_count == 0)
+			return;
+
+		AtomicValue<uint32_t> pending_count{static_cast<uint32_t>(task_count)};
+
+		if (!is_running())
+		{
+			// no workers - just run everything inline, in order
+			for (size_t i = 0; i < task_count; ++i)
+			{
+				tasks[i]->pending_count = &pending_count;
+				execute_task(*tasks[i]);
+			}
+			return;
+		}
+
+		// worker threads (and an external submitter re-entering from one of its own tasks) already own a queue:
+		const bool is_claiming_external_queue = (current_pool != this);
+		if (is_claiming_external_queue)
+		{
+			if (external_queue_in_use.test_and_set())
+				ROBOTICK_FATAL_EXIT("WorkerPool::run_and_wait() called concurrently from more than one non-worker thread");
+
+			current_pool = this;
+			current_queue_index = EXTERNAL_QUEUE_INDEX;
+		}
+
+		const uint32_t queue_index = current_queue_index;
+		auto& queue = workers[queue_index].queue;
+
+		// push in reverse so our own (LIFO) pops take tasks in submission order, while thieves take from the far end
+		for (size_t i = task_count; i-- > 0;)
+		{
+			WorkerTask* task = tasks[i];
+			task->pending_count = &pending_count;
+			if (!queue.push(task))
+				execute_task(*task); // queue full - run it inline
+		}
+
+		work_epoch.fetch_add(1);
+		if (parked_workers.load() > 0)
+			wake_parked_workers();
+
+		// help out until the whole batch is done (this is the barrier):
+		while (pending_count.load(std_approved::memory_order_acquire) > 0)
+		{
+			WorkerTask* task = nullptr;
+			if (find_task(queue_index, task))
+			{
+				execute_task(*task);
+			}
+			else
+			{
+				Thread::yield();
+			}
+		}
+
+		if (is_claiming_external_queue)
+		{
+			current_pool = nullptr;
+			current_queue_index = NOT_A_WORKER;
+			external_queue_in_use.clear();
+		}
+	}
+
+} // namespace robotick
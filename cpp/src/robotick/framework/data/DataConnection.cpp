@@ -101,6 +101,51 @@ namespace robotick
 			return true;
 		}
 
+		// Strips an element index from an instanced workload's token (e.g. "joints[12]" -> "joints", 12). Returns false if the
+		// index is malformed; out_has_index reports whether there was one at all.
+		inline bool extract_element_index(FixedString64& workload_token, uint32_t& out_element_index, bool& out_has_index)
+		{
+			out_element_index = 0;
+			out_has_index = false;
+
+			char* open_bracket = workload_token.data;
+			while (*open_bracket && *open_bracket != '[')
+				++open_bracket;
+			if (*open_bracket == '\0')
+				return true;
+
+			const char* index_cursor = open_bracket + 1;
+			if (*index_cursor < '0' || *index_cursor > '9')
+				return false;
+
+			uint64_t element_index = 0;
+			while (*index_cursor >= '0' && *index_cursor <= '9')
+			{
+				element_index = element_index * 10 + static_cast<uint64_t>(*index_cursor++ - '0');
+				if (element_index > UINT32_MAX)
+					return false;
+			}
+
+			if (index_cursor[0] != ']' || index_cursor[1] != '\0')
+				return false;
+
+			*open_bracket = '\0';
+			out_element_index = static_cast<uint32_t>(element_index);
+			out_has_index = true;
+			return true;
+		}
+
+		// Byte offset of the indexed element within an instanced workload, or false if the index doesn't suit the workload
+		inline bool get_element_offset(const WorkloadInstanceInfo& workload, uint32_t element_index, bool has_index, size_t& out_offset)
+		{
+			const bool is_instanced = workload.instance_count > 1;
+			if (is_instanced != has_index || element_index >= workload.instance_count)
+				return false;
+
+			out_offset = static_cast<size_t>(element_index) * workload.type->size;
+			return true;
+		}
+
 		// Walks a dotted member path inside an already-addressable container (supports static or dynamic structs).
 		// Example: container_ptr=ptr_to_vec2, container_type=Vec2f, dotted="x" or "position.x"
 		static bool resolve_nested_member(void* container_ptr,
@@ -180,11 +225,23 @@ namespace robotick
 			{
 				ROBOTICK_FATAL_EXIT("Workload token too long in path: %s", path);
 			}
+			uint32_t element_index = 0;
+			bool has_element_index = false;
+			if (!extract_element_index(workload_token, element_index, has_element_index))
+				ROBOTICK_FATAL_EXIT("Malformed element index in path: %s", path);
+
 			WorkloadInstanceInfo* const* found_workload_ptr = instances.find(workload_token.c_str());
 			const WorkloadInstanceInfo* workload = found_workload_ptr ? *found_workload_ptr : nullptr;
 			if (!workload)
 				ROBOTICK_FATAL_EXIT("Unknown workload: %s", workload_token.c_str());
 
+			size_t element_offset = 0;
+			if (!get_element_offset(*workload, element_index, has_element_index, element_offset))
+				ROBOTICK_FATAL_EXIT("Workload '%s' has %u instance(s) - invalid element index in path: %s",
+					workload_token.c_str(),
+					workload->instance_count,
+					path);
+
 			// Step 2: section (config, inputs, outputs)
 			FixedString64 section_token;
 			if (!extract_next_token(path_cursor, section_token))
@@ -210,7 +267,7 @@ namespace robotick
 			// field pointer stays stable even as other workloads expand.  That offset math mirrors the contiguous layout.
 			// get_data_ptr sums the engine's contiguous base pointer with the struct offset computed during Engine::load(),
 			// so every resolved pointer matches the deterministic layout even though the memory lives in a single buffer.
-			const uint8_t* ptr = (uint8_t*)field->get_data_ptr(workloads_buffer, *workload, *struct_type, struct_offset);
+			const uint8_t* ptr = (uint8_t*)field->get_data_ptr(workloads_buffer, *workload, *struct_type, struct_offset) + element_offset;
 			const TypeDescriptor* field_type_desc = field->find_type_descriptor();
 			if (!field_type_desc)
 				ROBOTICK_FATAL_EXIT("Field '%s' in path '%s' has unknown type '%s'", field_token.c_str(), path, field->type_id.get_debug_name());
@@ -350,6 +407,13 @@ namespace robotick
 			ROBOTICK_WARNING("Workload token too long in field path: %s", path);
 			return {nullptr, 0, nullptr};
 		}
+		uint32_t element_index = 0;
+		bool has_element_index = false;
+		if (!extract_element_index(workload_token, element_index, has_element_index))
+		{
+			ROBOTICK_WARNING("Malformed element index in field path: %s", path);
+			return {nullptr, 0, nullptr};
+		}
 		auto* workload_info_ptr = instances.find(workload_token.c_str());
 		if (!workload_info_ptr)
 		{
@@ -358,6 +422,13 @@ namespace robotick
 		}
 		const WorkloadInstanceInfo* workload_info = *workload_info_ptr;
 
+		size_t element_offset = 0;
+		if (!get_element_offset(*workload_info, element_index, has_element_index, element_offset))
+		{
+			ROBOTICK_WARNING("Invalid element index for workload '%s' in field path: %s", workload_token.c_str(), path);
+			return {nullptr, 0, nullptr};
+		}
+
 		// workload.section.field[.subfield]
 		FixedString64 section_token;
 		if (!extract_next_token(path_cursor, section_token))
@@ -390,7 +461,9 @@ namespace robotick
 		if (!field_type_desc)
 			ROBOTICK_FATAL_EXIT("Field '%s' in path '%s' has unknown type", field_token.c_str(), path);
 
-		void* base_ptr = field->get_data_ptr(const_cast<WorkloadsBuffer&>(workloads_buffer), *workload_info, *struct_type, struct_offset);
+		void* base_ptr =
+			static_cast<uint8_t*>(field->get_data_ptr(const_cast<WorkloadsBuffer&>(workloads_buffer), *workload_info, *struct_type, struct_offset)) +
+			element_offset;
 		size_t size = field_type_desc->size;
 
 		// optional subfield chain
@@ -0,0 +1,91 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/DirtyRegionTracker.h"
+
+#include "robotick/framework/data/WorkloadsBuffer.h"
+
+namespace robotick
+{
+	void DirtyRegionTracker::initialize(const RawBuffer& buffer, size_t size)
+	{
+		if (is_initialized())
+			ROBOTICK_FATAL_EXIT("DirtyRegionTracker::initialize() called more than once");
+
+		buffer_begin = buffer.raw_ptr();
+		tracked_size = (size < buffer.get_size()) ? size : buffer.get_size();
+
+		const size_t line_count = (tracked_size + LINE_BYTES - 1) / LINE_BYTES;
+		words.initialize((line_count + 63) / 64 > 0 ? (line_count + 63) / 64 : 1);
+	}
+
+	void DirtyRegionTracker::mark_dirty(const void* ptr, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(ptr);
+		if (!is_initialized() || bytes < buffer_begin)
+			return;
+
+		mark_dirty_range(static_cast<size_t>(bytes - buffer_begin), size);
+	}
+
+	void DirtyRegionTracker::mark_dirty_range(size_t offset, size_t size)
+	{
+		if (!is_initialized() || size == 0 || offset >= tracked_size)
+			return;
+
+		const size_t end = (size < tracked_size - offset) ? offset + size : tracked_size;
+		const size_t first_line = offset / LINE_BYTES;
+		const size_t last_line = (end - 1) / LINE_BYTES;
+
+		// one fetch_or per word touched, setting every line of the range within it:
+		for (size_t word_index = first_line / 64; word_index <= last_line / 64; ++word_index)
+		{
+			const size_t word_first_line = word_index * 64;
+			const size_t begin_bit = (first_line > word_first_line) ? first_line - word_first_line : 0;
+			const size_t end_bit = (last_line < word_first_line + 63) ? last_line - word_first_line : 63;
+
+			const uint64_t bits_to_end = (end_bit == 63) ? ~0ull : ((1ull << (end_bit + 1)) - 1);
+			const uint64_t mask = bits_to_end & ~((1ull << begin_bit) - 1);
+			words[word_index].fetch_or(mask, std_approved::memory_order_relaxed);
+		}
+	}
+
+	void DirtyRegionTracker::clear()
+	{
+		for (AtomicValue<uint64_t>& word : words)
+			word.store(0, std_approved::memory_order_relaxed);
+	}
+
+	bool DirtyRegionTracker::is_dirty(size_t offset) const
+	{
+		if (offset >= tracked_size)
+			return false;
+
+		const size_t line = offset / LINE_BYTES;
+		return (words[line / 64].load(std_approved::memory_order_relaxed) & (1ull << (line % 64))) != 0;
+	}
+
+	size_t DirtyRegionTracker::get_dirty_line_count() const
+	{
+		size_t count = 0;
+		for (const AtomicValue<uint64_t>& word : words)
+		{
+			uint64_t bits = word.load(std_approved::memory_order_relaxed);
+			while (bits != 0)
+			{
+				bits &= bits - 1;
+				count++;
+			}
+		}
+		return count;
+	}
+
+	void DirtyRegionTracker::accumulate_into(HeapVector<uint64_t>& accumulated_words) const
+	{
+		ROBOTICK_ASSERT_MSG(accumulated_words.size() == words.size(), "DirtyRegionTracker::accumulate_into: bitmap size mismatch");
+
+		for (size_t word_index = 0; word_index < words.size(); ++word_index)
+			accumulated_words[word_index] |= words[word_index].load(std_approved::memory_order_relaxed);
+	}
+
+} // namespace robotick
@@ -135,6 +135,9 @@ namespace robotick
 
 		state = target_state;
 
+		if (state != State::ReadyForFields)
+			is_fields_request_pending = false; // requests don't outlive the connection they arrived on
+
 		const bool is_receiver = (mode == Mode::Receiver);
 		const char* mode_str = is_receiver ? "Receiver" : "Sender";
 		const char* color_start = is_receiver ? "\033[33m" : "\033[32m"; // yellow : green
@@ -203,7 +206,15 @@ namespace robotick
 		binder = binder_callback;
 	}
 
-	void RemoteEngineConnection::tick(const TickInfo& tick_info)
+	void RemoteEngineConnection::set_field_received_callback(FieldReceivedCallback callback)
+	{
+		ROBOTICK_ASSERT_MSG(
+			mode == Mode::Receiver, "RemoteEngineConnection::set_field_received_callback() should only be called in Mode::Receiver");
+
+		field_received_callback = callback;
+	}
+
+	void RemoteEngineConnection::tick_receive(const TickInfo& tick_info)
 	{
 		if (state == State::Disconnected)
 		{
@@ -242,25 +253,17 @@ namespace robotick
 		{
 			if (mode == Mode::Sender)
 			{
-				if (ticks_until_next_send > 0)
-				{
-					ticks_until_next_send -= 1;
-					if (ticks_until_next_send == 0)
-					{
-						tick_send_fields_as_message(true);
-					}
-				}
-
-				// sender would expect to need to receive ready-message, then immediately send fields-data
+				// sender would expect to need to receive ready-message, then send fields-data (in tick_send(), once written)
 				if (tick_receive_fields_request())
 				{
-					// start sending one now; and schedule another for "ticks_until_next_send" time
+					// send one this tick; and schedule another for "ticks_until_next_send" time
 					const float mr = (mutual_tick_rate_hz > 0.0f) ? mutual_tick_rate_hz : tick_info.tick_rate_hz;
 					ticks_until_next_send = rtk_max<uint64_t>(1, (uint64_t)::floor(tick_info.tick_rate_hz / mr));
 					ROBOTICK_INFO_IF(ROBOTICK_REMOTE_ENGINE_CONNECTION_VERBOSE, "ticks_until_next_send: %i", (int)ticks_until_next_send);
-					tick_send_fields_as_message(true);
+					is_fields_request_pending = true;
 				}
 
+				// keep pumping any fields-message still in flight from an earlier tick
 				tick_send_fields_as_message(false);
 			}
 			else // Mode::Receiver
@@ -289,6 +292,24 @@ namespace robotick
 		}
 	}
 
+	void RemoteEngineConnection::tick_send()
+	{
+		if (mode != Mode::Sender || state != State::ReadyForFields)
+			return;
+
+		// start a new fields-message if one was requested this tick, or the scheduled one is now due:
+		bool should_start_new = is_fields_request_pending;
+		is_fields_request_pending = false;
+
+		if (!should_start_new && ticks_until_next_send > 0)
+		{
+			ticks_until_next_send -= 1;
+			should_start_new = (ticks_until_next_send == 0);
+		}
+
+		tick_send_fields_as_message(should_start_new);
+	}
+
 	bool RemoteEngineConnection::has_basic_connection() const
 	{
 		return socket_fd >= 0 && state != State::Disconnected;
@@ -989,6 +1010,9 @@ namespace robotick
 
 					if (field_receive_state.offset_in_field == field.size)
 					{
+						if (field_received_callback)
+							field_received_callback(field);
+
 						field_receive_state.field_index++;
 						field_receive_state.offset_in_field = 0;
 					}
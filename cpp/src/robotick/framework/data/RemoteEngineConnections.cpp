@@ -4,6 +4,7 @@
 #include "robotick/framework/data/RemoteEngineConnections.h"
 #include "robotick/api.h"
 #include "robotick/framework/Engine.h"
+#include "robotick/framework/data/DirtyRegionTracker.h"
 #include "robotick/framework/model/Model.h"
 
 #define ROBOTICK_REMOTE_ENGINE_CONNECTIONS_VERBOSE 0
@@ -53,6 +54,14 @@ namespace robotick
 						return true;
 					});
 
+				// wake event-driven workloads in the same tick their remote inputs arrive (and note what changed, if tracked):
+				conn.set_field_received_callback(
+					[this](const RemoteEngineConnection::Field& field)
+					{
+						engine->notify_input_written(field.recv_ptr);
+						engine->get_dirty_regions().mark_dirty(field.recv_ptr, field.size);
+					});
+
 				for (int i = 0; i < 10; ++i)
 				{
 					conn.tick(TICK_INFO_FIRST_10MS_100HZ);
@@ -145,7 +154,7 @@ namespace robotick
 		discoverer_receiver.shutdown();
 	}
 
-	void RemoteEngineConnections::tick(const TickInfo& tick_info)
+	void RemoteEngineConnections::tick_receive(const TickInfo& tick_info)
 	{
 		discoverer_receiver.tick(tick_info);
 
@@ -165,7 +174,13 @@ namespace robotick
 			dynamic_receiver.tick(tick_info);
 
 		for (auto& sender : senders)
-			sender.tick(tick_info);
+			sender.tick_receive(tick_info);
+	}
+
+	void RemoteEngineConnections::tick_send()
+	{
+		for (auto& sender : senders)
+			sender.tick_send();
 	}
 
 } // namespace robotick
@@ -0,0 +1,267 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/SharedWorkloadsBuffer.h"
+
+#include "robotick/framework/system/System.h"
+
+#include <cstring>
+#include <new> // placement new
+
+namespace robotick
+{
+	// Matches RawBuffer's own alignment, so the layout lines up with a heap-allocated buffer's.
+	static constexpr size_t SHARED_BUFFER_ALIGNMENT =
+		(DEFAULT_CACHE_LINE_BYTES > alignof(max_align_t)) ? DEFAULT_CACHE_LINE_BYTES : alignof(max_align_t);
+
+	static constexpr size_t SHARED_BUFFER_OFFSET =
+		(sizeof(SharedWorkloadsBufferHeader) + SHARED_BUFFER_ALIGNMENT - 1) & ~(SHARED_BUFFER_ALIGNMENT - 1);
+
+	static constexpr const char* LAYOUT_SEGMENT_SUFFIX = ".layout";
+
+	static void make_layout_segment_name(const FixedString128& name, FixedString128& out_layout_name)
+	{
+		out_layout_name.format("%s%s", name.c_str(), LAYOUT_SEGMENT_SUFFIX);
+	}
+
+	SharedWorkloadsSegment::SharedWorkloadsSegment(SharedWorkloadsSegment&& other) noexcept
+		: name(other.name)
+		, header(other.header)
+		, mapped_size(other.mapped_size)
+		, layout(other.layout)
+		, layout_mapped_size(other.layout_mapped_size)
+	{
+		other.name.clear();
+		other.header = nullptr;
+		other.mapped_size = 0;
+		other.layout = nullptr;
+		other.layout_mapped_size = 0;
+	}
+
+	SharedWorkloadsSegment& SharedWorkloadsSegment::operator=(SharedWorkloadsSegment&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			name = other.name;
+			header = other.header;
+			mapped_size = other.mapped_size;
+			layout = other.layout;
+			layout_mapped_size = other.layout_mapped_size;
+			other.name.clear();
+			other.header = nullptr;
+			other.mapped_size = 0;
+			other.layout = nullptr;
+			other.layout_mapped_size = 0;
+		}
+		return *this;
+	}
+
+	bool SharedWorkloadsSegment::create(const char* in_name, size_t buffer_size)
+	{
+		if (header != nullptr)
+			ROBOTICK_FATAL_EXIT("SharedWorkloadsSegment: attempt to create twice");
+
+		if (in_name == nullptr || in_name[0] != '/' || ::strlen(in_name) + ::strlen(LAYOUT_SEGMENT_SUFFIX) >= name.capacity())
+			ROBOTICK_FATAL_EXIT("SharedWorkloadsSegment: invalid segment name '%s' - expected e.g. \"/robotick_arm\"", in_name ? in_name : "");
+
+		bool is_existing = false;
+		void* mapped = System::create_shared_memory(in_name, SHARED_BUFFER_OFFSET + buffer_size, mapped_size, is_existing);
+		if (mapped == nullptr && is_existing)
+		{
+			// only replaced once provably stale - a whole header, of this version, whose owner has gone:
+			int64_t owner_process_id = 0;
+			size_t existing_mapped_size = 0;
+			const void* existing = System::open_shared_memory(in_name, existing_mapped_size);
+			if (existing != nullptr && existing_mapped_size >= sizeof(SharedWorkloadsBufferHeader))
+			{
+				const auto* existing_header = static_cast<const SharedWorkloadsBufferHeader*>(existing);
+				if (existing_header->magic.load() == SharedWorkloadsBufferHeader::MAGIC &&
+					existing_header->version == SharedWorkloadsBufferHeader::VERSION)
+				{
+					owner_process_id = existing_header->owner_process_id;
+				}
+			}
+			System::unmap_shared_memory(existing, existing_mapped_size);
+
+			if (owner_process_id == 0)
+				ROBOTICK_FATAL_EXIT("SharedWorkloadsSegment: a shared-memory segment named '%s' already exists, and isn't a stale one of ours "
+									"- remove it (e.g. from /dev/shm) if nothing is using it",
+					in_name);
+			if (System::is_process_alive(owner_process_id))
+				ROBOTICK_FATAL_EXIT("SharedWorkloadsSegment: segment '%s' is in use by a running engine (process %lld)",
+					in_name,
+					static_cast<long long>(owner_process_id));
+
+			// (readers still attached to the stale one keep their mappings - the name just resolves to ours from now on)
+			ROBOTICK_WARNING("SharedWorkloadsSegment: replacing segment '%s' left behind by process %lld, which has gone",
+				in_name,
+				static_cast<long long>(owner_process_id));
+			System::unlink_shared_memory(in_name);
+			mapped = System::create_shared_memory(in_name, SHARED_BUFFER_OFFSET + buffer_size, mapped_size, is_existing);
+		}
+		if (mapped == nullptr)
+			return false;
+
+		name = in_name;
+
+		// the name is ours now, so any layout segment still under it was left behind along with a stale segment:
+		FixedString128 layout_name;
+		make_layout_segment_name(name, layout_name);
+		System::unlink_shared_memory(layout_name.c_str());
+
+		header = new (mapped) SharedWorkloadsBufferHeader();
+		header->version = SharedWorkloadsBufferHeader::VERSION;
+		header->owner_process_id = System::get_process_id();
+		header->buffer_offset = SHARED_BUFFER_OFFSET;
+		header->buffer_size = buffer_size;
+		header->magic.store(SharedWorkloadsBufferHeader::MAGIC);
+		return true;
+	}
+
+	void SharedWorkloadsSegment::release()
+	{
+		if (header == nullptr)
+			return;
+
+		if (layout != nullptr)
+		{
+			FixedString128 layout_name;
+			make_layout_segment_name(name, layout_name);
+			System::unlink_shared_memory(layout_name.c_str());
+			System::unmap_shared_memory(layout, layout_mapped_size);
+		}
+
+		// readers already attached keep their mappings - the name just stops resolving for new ones:
+		System::unlink_shared_memory(name.c_str());
+		header->~SharedWorkloadsBufferHeader();
+		System::unmap_shared_memory(header, mapped_size);
+
+		name.clear();
+		header = nullptr;
+		mapped_size = 0;
+		layout = nullptr;
+		layout_mapped_size = 0;
+	}
+
+	uint8_t* SharedWorkloadsSegment::get_buffer() const
+	{
+		return header ? reinterpret_cast<uint8_t*>(header) + SHARED_BUFFER_OFFSET : nullptr;
+	}
+
+	bool SharedWorkloadsSegment::publish_layout(const char* layout_json, size_t layout_json_size)
+	{
+		if (header == nullptr || layout_json == nullptr)
+			return false;
+
+		if (layout != nullptr)
+			ROBOTICK_FATAL_EXIT("SharedWorkloadsSegment: layout for '%s' already published", name.c_str());
+
+		FixedString128 layout_name;
+		make_layout_segment_name(name, layout_name);
+
+		// (zero-filled, so null-terminated)
+		bool is_existing = false;
+		layout = System::create_shared_memory(layout_name.c_str(), layout_json_size + 1, layout_mapped_size, is_existing);
+		if (layout == nullptr)
+			return false;
+
+		::memcpy(layout, layout_json, layout_json_size);
+		header->layout_size.store(static_cast<uint32_t>(layout_json_size));
+		return true;
+	}
+
+	bool SharedWorkloadsBufferReader::attach(const char* in_name)
+	{
+		detach();
+
+		if (in_name == nullptr || ::strlen(in_name) + ::strlen(LAYOUT_SEGMENT_SUFFIX) >= name.capacity())
+			return false;
+
+		const void* mapped = System::open_shared_memory(in_name, mapped_size);
+		if (mapped == nullptr)
+			return false;
+
+		const auto* mapped_header = static_cast<const SharedWorkloadsBufferHeader*>(mapped);
+		const bool is_valid = mapped_size >= sizeof(SharedWorkloadsBufferHeader) &&
+							  mapped_header->magic.load() == SharedWorkloadsBufferHeader::MAGIC &&
+							  mapped_header->version == SharedWorkloadsBufferHeader::VERSION &&
+							  mapped_header->buffer_offset + mapped_header->buffer_size <= mapped_size;
+		if (!is_valid)
+		{
+			System::unmap_shared_memory(mapped, mapped_size);
+			mapped_size = 0;
+			return false;
+		}
+
+		name = in_name;
+		header = mapped_header;
+		return true;
+	}
+
+	void SharedWorkloadsBufferReader::detach()
+	{
+		if (layout != nullptr)
+			System::unmap_shared_memory(layout, layout_mapped_size);
+		if (header != nullptr)
+			System::unmap_shared_memory(header, mapped_size);
+
+		name.clear();
+		header = nullptr;
+		mapped_size = 0;
+		layout = nullptr;
+		layout_mapped_size = 0;
+	}
+
+	const uint8_t* SharedWorkloadsBufferReader::get_buffer() const
+	{
+		return header ? reinterpret_cast<const uint8_t*>(header) + header->buffer_offset : nullptr;
+	}
+
+	size_t SharedWorkloadsBufferReader::get_buffer_size_used() const
+	{
+		return header ? static_cast<size_t>(header->buffer_size_used.load()) : 0;
+	}
+
+	const char* SharedWorkloadsBufferReader::get_layout_json()
+	{
+		if (header == nullptr || header->layout_size.load() == 0)
+			return nullptr;
+
+		if (layout == nullptr)
+		{
+			FixedString128 layout_name;
+			make_layout_segment_name(name, layout_name);
+
+			layout = System::open_shared_memory(layout_name.c_str(), layout_mapped_size);
+			if (layout == nullptr || layout_mapped_size <= header->layout_size.load())
+			{
+				System::unmap_shared_memory(layout, layout_mapped_size);
+				layout = nullptr;
+				layout_mapped_size = 0;
+				return nullptr;
+			}
+		}
+
+		return static_cast<const char*>(layout);
+	}
+
+	bool SharedWorkloadsBufferReader::begin_read(uint32_t& out_frame_seq) const
+	{
+		if (header == nullptr)
+			return false;
+
+		out_frame_seq = header->frame_seq.load(std_approved::memory_order_acquire);
+		return (out_frame_seq & 1u) == 0u;
+	}
+
+	bool SharedWorkloadsBufferReader::end_read(uint32_t frame_seq) const
+	{
+		if (header == nullptr)
+			return false;
+
+		thread_fence_acquire(); // keep the frame's reads before the re-check
+		return header->frame_seq.load(std_approved::memory_order_relaxed) == frame_seq;
+	}
+
+} // namespace robotick
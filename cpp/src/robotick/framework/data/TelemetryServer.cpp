@@ -8,7 +8,9 @@
 #include "robotick/framework/concurrency/Sync.h"
 #include "robotick/framework/containers/HeapVector.h"
 #include "robotick/framework/data/DataConnection.h"
+#include "robotick/framework/data/DirtyRegionTracker.h"
 #include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
 #include "robotick/framework/registry/TypeDescriptor.h"
 #include "robotick/framework/services/WebServer.h"
 #include "robotick/framework/strings/FixedString.h"
@@ -302,6 +304,9 @@ namespace robotick
 
 			::memcpy(writable.target_ptr, pending.payload, writable.value_size);
 			pending.pending = false;
+
+			impl->engine->notify_input_written(writable.target_ptr);
+			impl->engine->get_dirty_regions().mark_dirty(writable.target_ptr, writable.value_size);
 		}
 	}
 
@@ -372,15 +377,6 @@ namespace robotick
 					continue;
 				}
 
-				void* inputs_ptr = const_cast<uint8_t*>(workload_ptr) + desc->inputs_offset;
-				if (!workloads_buffer.contains_object_used_space(inputs_ptr, inputs_type->size))
-				{
-					continue;
-				}
-
-				FixedString512 root_path;
-				root_path.format("%s.inputs", workload_instance_info.seed->unique_name.c_str());
-
 				const auto walk_struct = [&](const auto& self,
 											 const TypeDescriptor* struct_type,
 											 void* struct_ptr,
@@ -438,7 +434,29 @@ namespace robotick
 					}
 				};
 
-				walk_struct(walk_struct, inputs_type, inputs_ptr, root_path, on_leaf);
+				// (each element of an instanced workload has its own inputs, addressed as "name[i].inputs")
+				const uint32_t element_count = workload_instance_info.instance_count;
+				for (uint32_t element_index = 0; element_index < element_count; ++element_index)
+				{
+					void* inputs_ptr =
+						const_cast<uint8_t*>(workload_ptr) + element_index * workload_instance_info.get_element_size() + desc->inputs_offset;
+					if (!workloads_buffer.contains_object_used_space(inputs_ptr, inputs_type->size))
+					{
+						continue;
+					}
+
+					FixedString512 root_path;
+					if (element_count > 1)
+					{
+						root_path.format("%s[%u].inputs", workload_instance_info.seed->unique_name.c_str(), element_index);
+					}
+					else
+					{
+						root_path.format("%s.inputs", workload_instance_info.seed->unique_name.c_str());
+					}
+
+					walk_struct(walk_struct, inputs_type, inputs_ptr, root_path, on_leaf);
+				}
 			}
 		};
 
@@ -828,23 +846,41 @@ namespace robotick
 				continue;
 			}
 
-			nlohmann::ordered_json workload_json;
-			workload_json["name"] = workload_instance_info.seed->unique_name;
-			workload_json["type"] = workload_instance_info.type->name.c_str();
-			workload_json["offset_within_container"] = static_cast<int>(workload_instance_info.offset_in_workloads_buffer);
+			emit_type_info(layout_json, workloads_buffer, workload_instance_info.workload_stats, workload_stats_type);
 
-			void* workload_ptr = (void*)workload_instance_info.get_ptr(workloads_buffer);
+			// (one entry per element of an instanced workload - "name[i]" - each sharing the instance's stats)
+			const uint32_t element_count = workload_instance_info.instance_count;
+			for (uint32_t element_index = 0; element_index < element_count; ++element_index)
+			{
+				const size_t element_offset = element_index * workload_instance_info.get_element_size();
+
+				nlohmann::ordered_json workload_json;
+				if (element_count > 1)
+				{
+					FixedString128 element_name;
+					element_name.format("%s[%u]", workload_instance_info.seed->unique_name.c_str(), element_index);
+					workload_json["name"] = element_name.c_str();
+				}
+				else
+				{
+					workload_json["name"] = workload_instance_info.seed->unique_name;
+				}
+				workload_json["type"] = workload_instance_info.type->name.c_str();
+				workload_json["offset_within_container"] =
+					static_cast<int>(workload_instance_info.offset_in_workloads_buffer + element_offset);
 
-			emit_struct_info(layout_json, workload_json, workloads_buffer, workload_ptr, "config", desc->config_desc, desc->config_offset);
-			emit_struct_info(layout_json, workload_json, workloads_buffer, workload_ptr, "inputs", desc->inputs_desc, desc->inputs_offset);
-			emit_struct_info(layout_json, workload_json, workloads_buffer, workload_ptr, "outputs", desc->outputs_desc, desc->outputs_offset);
+				void* workload_ptr = (void*)(workload_instance_info.get_ptr(workloads_buffer) + element_offset);
 
-			workload_json["stats_offset_within_container"] =
-				static_cast<int>((uint8_t*)workload_instance_info.workload_stats - workloads_buffer.raw_ptr());
+				emit_struct_info(layout_json, workload_json, workloads_buffer, workload_ptr, "config", desc->config_desc, desc->config_offset);
+				emit_struct_info(layout_json, workload_json, workloads_buffer, workload_ptr, "inputs", desc->inputs_desc, desc->inputs_offset);
+				emit_struct_info(
+					layout_json, workload_json, workloads_buffer, workload_ptr, "outputs", desc->outputs_desc, desc->outputs_offset);
 
-			emit_type_info(layout_json, workloads_buffer, workload_instance_info.workload_stats, workload_stats_type);
+				workload_json["stats_offset_within_container"] =
+					static_cast<int>((uint8_t*)workload_instance_info.workload_stats - workloads_buffer.raw_ptr());
 
-			layout_json["workloads"].push_back(workload_json);
+				layout_json["workloads"].push_back(workload_json);
+			}
 		}
 
 		robotick::sort(layout_json["workloads"].begin(),
@@ -902,11 +938,21 @@ namespace robotick
 		session_header.format("X-Robotick-Session-Id:%s", session_id.c_str());
 		res.add_header(session_header.c_str());
 
+		// serve the latest published snapshot where there is one - a whole frame, however long the client takes to read it:
+		WorkloadsBufferSnapshots::Lease snapshot;
+		if (engine->get_workloads_buffer_snapshots().is_initialized())
+			snapshot = engine->get_workloads_buffer_snapshots().acquire();
+
+		const uint32_t frame_seq = snapshot.is_valid() ? snapshot.get_frame_seq() : workloads_buffer.get_telemetry_frame_seq();
+
 		FixedString256 frame_seq_header;
-		frame_seq_header.format("X-Robotick-Frame-Seq:%u", static_cast<unsigned int>(workloads_buffer.get_telemetry_frame_seq()));
+		frame_seq_header.format("X-Robotick-Frame-Seq:%u", static_cast<unsigned int>(frame_seq));
 		res.add_header(frame_seq_header.c_str());
 
-		res.set_body(workloads_buffer.raw_ptr(), workloads_buffer.get_size_used());
+		if (snapshot.is_valid())
+			res.set_body(snapshot.data(), snapshot.size());
+		else
+			res.set_body(workloads_buffer.raw_ptr(), workloads_buffer.get_size_used());
 	}
 
 	nlohmann::ordered_json build_workloads_buffer_layout_json(const Engine& engine, const char* session_id_override)
@@ -3,15 +3,22 @@
 
 #include "robotick/framework/data/WorkloadsBuffer.h"
 
+#include "robotick/framework/data/DirtyRegionTracker.h"
+#include "robotick/framework/system/System.h"
+
 #include <cstring>
 #include <new> // operator new/delete with alignment
 
 namespace robotick
 {
-	RawBuffer::RawBuffer(size_t size)
+	// Cache-line aligned (rather than just max_align_t) so that layouts padding to cache lines line up with the real ones.
+	static constexpr size_t BUFFER_ALIGNMENT =
+		(DEFAULT_CACHE_LINE_BYTES > alignof(max_align_t)) ? DEFAULT_CACHE_LINE_BYTES : alignof(max_align_t);
+
+	RawBuffer::RawBuffer(size_t size, WorkloadsBufferAllocation allocation, const char* shared_memory_name)
 		: size(size)
 	{
-		allocate_aligned(size);
+		allocate_aligned(size, allocation, shared_memory_name);
 	}
 
 	RawBuffer& RawBuffer::operator=(RawBuffer&& other) noexcept
@@ -74,12 +81,39 @@ namespace robotick
 		::memcpy(data.get(), source.data.get(), size);
 	}
 
+	void RawBuffer::update_mirror_from(const RawBuffer& source, const DirtyRegionTracker& dirty_regions)
+	{
+		if (!data.is_allocated() || size == 0)
+			ROBOTICK_FATAL_EXIT("RawBuffer::mirror_from: destination buffer not initialized");
+
+		if (size != source.size)
+			ROBOTICK_FATAL_EXIT("RawBuffer::update_mirror_from: size mismatch");
+
+		dirty_regions.for_each_dirty_range(
+			[&](size_t offset, size_t range_size)
+			{
+				::memcpy(data.get() + offset, source.data.get() + offset, range_size);
+			});
+	}
+
+	bool RawBuffer::publish_shared_layout(const char* layout_json, size_t layout_json_size)
+	{
+		return data.shared_segment.publish_layout(layout_json, layout_json_size);
+	}
+
 	RawBuffer::AlignedStorage::AlignedStorage(AlignedStorage&& other) noexcept
 		: ptr(other.ptr)
 		, size(other.size)
+		, mapped_size(other.mapped_size)
+		, is_mapped(other.is_mapped)
+		, is_locked(other.is_locked)
+		, shared_segment(robotick::move(other.shared_segment))
 	{
 		other.ptr = nullptr;
 		other.size = 0;
+		other.mapped_size = 0;
+		other.is_mapped = false;
+		other.is_locked = false;
 	}
 
 	RawBuffer::AlignedStorage& RawBuffer::AlignedStorage::operator=(AlignedStorage&& other) noexcept
@@ -89,8 +123,15 @@ namespace robotick
 			release();
 			ptr = other.ptr;
 			size = other.size;
+			mapped_size = other.mapped_size;
+			is_mapped = other.is_mapped;
+			is_locked = other.is_locked;
+			shared_segment = robotick::move(other.shared_segment);
 			other.ptr = nullptr;
 			other.size = 0;
+			other.mapped_size = 0;
+			other.is_mapped = false;
+			other.is_locked = false;
 		}
 		return *this;
 	}
@@ -115,12 +156,43 @@ namespace robotick
 		return ptr != nullptr;
 	}
 
-	void RawBuffer::AlignedStorage::allocate(size_t alloc_size)
+	void RawBuffer::AlignedStorage::allocate(size_t alloc_size, WorkloadsBufferAllocation allocation, const char* shared_memory_name)
 	{
 		if (ptr != nullptr)
 			ROBOTICK_FATAL_EXIT("AlignedStorage: attempt to allocate twice");
 
-		void* raw = ::operator new(alloc_size, robotick::align_val_t{alignof(max_align_t)});
+		if (allocation == WorkloadsBufferAllocation::SharedMemory)
+		{
+			// whole pages after the header, cache-line aligned - and already zeroed
+			if (shared_segment.create(shared_memory_name, alloc_size))
+			{
+				ptr = shared_segment.get_buffer();
+				size = alloc_size;
+				return;
+			}
+
+			ROBOTICK_WARNING("AlignedStorage: shared memory unavailable for %zu bytes - falling back to the heap", alloc_size);
+		}
+
+		if (allocation == WorkloadsBufferAllocation::LockedPages)
+		{
+			// whole pages, so always at least cache-line aligned - and already zeroed
+			void* mapped = System::map_locked_memory(alloc_size, mapped_size, is_locked);
+			if (mapped != nullptr)
+			{
+				if (!is_locked)
+					ROBOTICK_WARNING("AlignedStorage: could not lock %zu bytes into RAM (see RLIMIT_MEMLOCK) - pre-faulted only", mapped_size);
+
+				ptr = static_cast<uint8_t*>(mapped);
+				size = alloc_size;
+				is_mapped = true;
+				return;
+			}
+
+			ROBOTICK_WARNING("AlignedStorage: locked pages unavailable for %zu bytes - falling back to the heap", alloc_size);
+		}
+
+		void* raw = ::operator new(alloc_size, robotick::align_val_t{BUFFER_ALIGNMENT});
 		::memset(raw, 0, alloc_size);
 		ptr = static_cast<uint8_t*>(raw);
 		size = alloc_size;
@@ -128,17 +200,29 @@ namespace robotick
 
 	void RawBuffer::AlignedStorage::release()
 	{
-		if (ptr)
+		if (ptr && shared_segment.is_created())
 		{
-			::operator delete(ptr, robotick::align_val_t{alignof(max_align_t)});
-			ptr = nullptr;
-			size = 0;
+			shared_segment.release();
 		}
+		else if (ptr && is_mapped)
+		{
+			System::unmap_locked_memory(ptr, mapped_size);
+		}
+		else if (ptr)
+		{
+			::operator delete(ptr, robotick::align_val_t{BUFFER_ALIGNMENT});
+		}
+
+		ptr = nullptr;
+		size = 0;
+		mapped_size = 0;
+		is_mapped = false;
+		is_locked = false;
 	}
 
-	void RawBuffer::allocate_aligned(size_t alloc_size)
+	void RawBuffer::allocate_aligned(size_t alloc_size, WorkloadsBufferAllocation allocation, const char* shared_memory_name)
 	{
-		data.allocate(alloc_size);
+		data.allocate(alloc_size, allocation, shared_memory_name);
 	}
 
 	WorkloadsBuffer::WorkloadsBuffer(WorkloadsBuffer&& other) noexcept
@@ -162,6 +246,10 @@ namespace robotick
 	void WorkloadsBuffer::set_size_used(const size_t value)
 	{
 		size_used = value;
+
+		SharedWorkloadsBufferHeader* shared_header = get_shared_header();
+		if (shared_header != nullptr)
+			shared_header->buffer_size_used.store(value);
 	}
 
 	size_t WorkloadsBuffer::get_size_used() const
@@ -0,0 +1,159 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
+
+#include "robotick/framework/data/DirtyRegionTracker.h"
+#include "robotick/framework/utility/Algorithm.h"
+
+#include <cstring>
+
+namespace robotick
+{
+	WorkloadsBufferSnapshots::Lease& WorkloadsBufferSnapshots::Lease::operator=(Lease&& other) noexcept
+	{
+		if (this != &other)
+		{
+			release();
+			snapshots = other.snapshots;
+			slot_index = other.slot_index;
+			other.snapshots = nullptr;
+		}
+		return *this;
+	}
+
+	const uint8_t* WorkloadsBufferSnapshots::Lease::data() const
+	{
+		ROBOTICK_ASSERT_MSG(is_valid(), "WorkloadsBufferSnapshots::Lease: no snapshot held");
+		return snapshots->slots[slot_index].buffer.raw_ptr();
+	}
+
+	size_t WorkloadsBufferSnapshots::Lease::size() const
+	{
+		return is_valid() ? snapshots->slots[slot_index].size : 0;
+	}
+
+	uint32_t WorkloadsBufferSnapshots::Lease::get_frame_seq() const
+	{
+		return is_valid() ? snapshots->slots[slot_index].frame_seq : 0;
+	}
+
+	void WorkloadsBufferSnapshots::Lease::release()
+	{
+		if (snapshots == nullptr)
+			return;
+
+		// release: our reads of the slot happen-before the tick re-claiming it
+		snapshots->slots[slot_index].pin_count.fetch_sub(1, std_approved::memory_order_release);
+		snapshots = nullptr;
+	}
+
+	void WorkloadsBufferSnapshots::initialize(const WorkloadsBuffer& source, uint32_t reader_count, const DirtyRegionTracker* in_dirty_regions)
+	{
+		if (is_initialized())
+			ROBOTICK_FATAL_EXIT("WorkloadsBufferSnapshots::initialize() called more than once");
+		if (reader_count == 0)
+			ROBOTICK_FATAL_EXIT("WorkloadsBufferSnapshots: reader_count must be at least 1");
+
+		const size_t size = source.get_size_used() > 0 ? source.get_size_used() : 1;
+
+		dirty_regions = (in_dirty_regions != nullptr && in_dirty_regions->is_initialized()) ? in_dirty_regions : nullptr;
+
+		slots.initialize(reader_count + 2);
+		for (Slot& slot : slots)
+		{
+			slot.buffer = RawBuffer(size);
+
+			// every line is stale until the slot is first filled:
+			if (dirty_regions != nullptr)
+			{
+				slot.stale_lines.initialize(dirty_regions->get_word_count());
+				robotick::fill(slot.stale_lines.begin(), slot.stale_lines.end(), ~0ull);
+			}
+		}
+	}
+
+	void WorkloadsBufferSnapshots::copy_into_slot(Slot& slot, const WorkloadsBuffer& source)
+	{
+		const size_t size_used = source.get_size_used();
+		ROBOTICK_ASSERT_MSG(size_used <= slot.buffer.get_size(),
+			"WorkloadsBufferSnapshots: buffer has grown (%zu bytes) since snapshots were sized (%zu bytes)",
+			size_used,
+			slot.buffer.get_size());
+
+		slot.size = size_used;
+		slot.frame_seq = source.get_telemetry_frame_seq();
+
+		if (dirty_regions == nullptr)
+		{
+			::memcpy(slot.buffer.raw_ptr(), source.raw_ptr(), size_used);
+			return;
+		}
+
+		// just the lines written since this slot was last filled:
+		DirtyRegionTracker::for_each_range(slot.stale_lines,
+			dirty_regions->get_tracked_size(),
+			[&](size_t offset, size_t range_size)
+			{
+				::memcpy(slot.buffer.raw_ptr() + offset, source.raw_ptr() + offset, range_size);
+			});
+		robotick::fill(slot.stale_lines.begin(), slot.stale_lines.end(), 0ull);
+	}
+
+	void WorkloadsBufferSnapshots::publish(const WorkloadsBuffer& source)
+	{
+		const uint32_t latest_index = latest_slot.load(std_approved::memory_order_relaxed); // only we ever store it
+
+		// every slot (even pinned ones, for once they're free again) is now stale wherever this frame wrote:
+		if (dirty_regions != nullptr)
+		{
+			for (Slot& slot : slots)
+				dirty_regions->accumulate_into(slot.stale_lines);
+		}
+
+		for (uint32_t slot_index = 0; slot_index < slots.size(); ++slot_index)
+		{
+			if (slot_index == latest_index)
+				continue;
+
+			// claim it only if no reader has it pinned - acquire: their reads of it happen-before our writes
+			Slot& slot = slots[slot_index];
+			uint32_t expected_pin_count = 0;
+			if (!slot.pin_count.compare_exchange_strong(
+					expected_pin_count, WRITING_BIT, std_approved::memory_order_acquire, std_approved::memory_order_relaxed))
+			{
+				continue;
+			}
+
+			copy_into_slot(slot, source);
+
+			// release: a reader pinning it from here on sees the whole frame (readers that raced us see WRITING_BIT, and back off)
+			slot.pin_count.fetch_sub(WRITING_BIT, std_approved::memory_order_release);
+			latest_slot.store(slot_index, std_approved::memory_order_release);
+			published_count.fetch_add(1, std_approved::memory_order_relaxed);
+			return;
+		}
+
+		// every other slot is pinned (more readers than we were sized for) - drop this frame rather than wait on them
+		skipped_publish_count.fetch_add(1, std_approved::memory_order_relaxed);
+	}
+
+	WorkloadsBufferSnapshots::Lease WorkloadsBufferSnapshots::acquire()
+	{
+		while (true)
+		{
+			const uint32_t slot_index = latest_slot.load(std_approved::memory_order_acquire);
+			if (slot_index == NO_SLOT)
+				return Lease();
+
+			// pin it, then check the tick hadn't already claimed it to overwrite (it won't once we're pinned)
+			Slot& slot = slots[slot_index];
+			const uint32_t previous_pin_count = slot.pin_count.fetch_add(1, std_approved::memory_order_acquire);
+			if ((previous_pin_count & WRITING_BIT) == 0)
+				return Lease(*this, slot_index);
+
+			slot.pin_count.fetch_sub(1, std_approved::memory_order_relaxed);
+		}
+	}
+
+} // namespace robotick
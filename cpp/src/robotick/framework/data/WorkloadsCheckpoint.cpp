@@ -0,0 +1,261 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/WorkloadsCheckpoint.h"
+
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/WorkloadInstanceInfo.h"
+#include "robotick/framework/registry/TypeDescriptor.h"
+#include "robotick/framework/strings/FixedString.h"
+#include "robotick/framework/utility/Hash.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace robotick
+{
+	namespace
+	{
+		// Calls region_fn(offset, size, field) for each plain-data range of the engine's buffer that a checkpoint holds (see
+		// WorkloadsCheckpoint), in a fixed order - so two engines loading the same model find the same ranges. field is the one
+		// the range holds, or nullptr for the whole of a checkpointable workload.
+		template <typename RegionFn> void for_each_checkpoint_region(const Engine& engine, RegionFn&& region_fn)
+		{
+			const uint8_t* buffer_begin = engine.get_workloads_buffer().raw_ptr();
+			auto emit = [&](const uint8_t* ptr, size_t size, const FieldDescriptor* field)
+			{
+				if (size > 0)
+					region_fn(static_cast<size_t>(ptr - buffer_begin), size, field);
+			};
+
+			auto emit_struct = [&](const uint8_t* struct_ptr, const TypeDescriptor* struct_type)
+			{
+				const StructDescriptor* struct_desc = struct_type ? struct_type->get_struct_desc() : nullptr;
+				if (struct_desc == nullptr)
+					return;
+
+				for (const FieldDescriptor& field : struct_desc->fields)
+				{
+					const TypeDescriptor* field_type = field.find_type_descriptor();
+					ROBOTICK_ASSERT_MSG(field_type != nullptr, "Field '%s' has no type descriptor", field.name.c_str());
+					const uint8_t* field_ptr = struct_ptr + field.offset_within_container;
+
+					const DynamicStructDescriptor* dynamic_desc = field_type->get_dynamic_struct_desc();
+					if (dynamic_desc == nullptr)
+					{
+						emit(field_ptr, field_type->size * field.element_count, &field);
+						continue;
+					}
+
+					// a blackboard: just the data it is bound to, not the header itself (which points at its field list)
+					const StructDescriptor* bound_desc = dynamic_desc->get_struct_descriptor(field_ptr);
+					if (bound_desc == nullptr)
+						continue;
+
+					for (const FieldDescriptor& bound_field : bound_desc->fields)
+					{
+						const TypeDescriptor* bound_type = bound_field.find_type_descriptor();
+						if (bound_type != nullptr && bound_field.offset_within_container != OFFSET_UNBOUND)
+							emit(field_ptr + bound_field.offset_within_container, bound_type->size * bound_field.element_count, &bound_field);
+					}
+				}
+			};
+
+			for (const WorkloadInstanceInfo& instance : engine.get_all_instance_info())
+			{
+				const WorkloadDescriptor* workload_desc = instance.workload_descriptor;
+				if (workload_desc == nullptr)
+					continue;
+
+				instance.for_each_element(instance.get_ptr(engine),
+					[&](uint8_t* element_ptr)
+					{
+						if (workload_desc->is_checkpointable)
+						{
+							emit(element_ptr, instance.get_element_size(), nullptr);
+							return;
+						}
+
+						// (not config - that comes from the model, which may have been changed since)
+						emit_struct(element_ptr + workload_desc->inputs_offset, workload_desc->inputs_desc);
+						emit_struct(element_ptr + workload_desc->outputs_offset, workload_desc->outputs_desc);
+					});
+			}
+		}
+
+		uint32_t hash_data(const uint8_t* data, size_t size)
+		{
+			Hash32 hash;
+			hash.update(data, size);
+			return hash.final();
+		}
+	} // namespace
+
+	void WorkloadsCheckpoint::initialize(const Engine& engine)
+	{
+		if (initialized)
+			ROBOTICK_FATAL_EXIT("WorkloadsCheckpoint::initialize() called more than once");
+
+		// count the regions (merging those that abut), then fill them in:
+		size_t region_count = 0;
+		size_t previous_end = OFFSET_UNBOUND;
+		for_each_checkpoint_region(engine,
+			[&](size_t offset, size_t size, const FieldDescriptor*)
+			{
+				if (offset != previous_end)
+					region_count++;
+				previous_end = offset + size;
+			});
+
+		if (region_count > 0)
+			regions.initialize(region_count);
+
+		Hash32 hash;
+		size_t region_index = 0;
+		for_each_checkpoint_region(engine,
+			[&](size_t offset, size_t size, const FieldDescriptor* field)
+			{
+				// (before merging, so the hash still tells apart fields that were swapped for others of the same size)
+				if (field != nullptr)
+				{
+					hash.update_cstring(field->name.c_str());
+					hash.update(static_cast<uint32_t>(field->type_id));
+				}
+				hash.update(static_cast<uint64_t>(offset));
+				hash.update(static_cast<uint64_t>(size));
+
+				if (region_index > 0 && regions[region_index - 1].offset + regions[region_index - 1].size == offset)
+				{
+					regions[region_index - 1].size += size;
+				}
+				else
+				{
+					regions[region_index].offset = offset;
+					regions[region_index].size = size;
+					region_index++;
+				}
+			});
+
+		for (const WorkloadInstanceInfo& instance : engine.get_all_instance_info())
+		{
+			hash.update_cstring(instance.seed ? instance.seed->unique_name.c_str() : nullptr);
+			hash.update_cstring(instance.type ? instance.type->name.c_str() : nullptr);
+		}
+
+		data_size = 0;
+		for (const Region& region : regions)
+			data_size += region.size;
+
+		layout_hash = hash.final();
+		if (data_size > 0)
+			data = RawBuffer(data_size);
+		initialized = true;
+	}
+
+	void WorkloadsCheckpoint::capture(const WorkloadsBuffer& source)
+	{
+		ROBOTICK_ASSERT_MSG(initialized, "WorkloadsCheckpoint::capture() before initialize()");
+
+		uint8_t* data_cursor = data.raw_ptr();
+		for (const Region& region : regions)
+		{
+			::memcpy(data_cursor, source.raw_ptr() + region.offset, region.size);
+			data_cursor += region.size;
+		}
+
+		frame_seq = source.get_telemetry_frame_seq();
+		has_captured_data = true;
+	}
+
+	void WorkloadsCheckpoint::apply(WorkloadsBuffer& target) const
+	{
+		ROBOTICK_ASSERT_MSG(has_captured_data, "WorkloadsCheckpoint::apply() without anything captured or loaded");
+
+		const uint8_t* data_cursor = data.raw_ptr();
+		for (const Region& region : regions)
+		{
+			::memcpy(target.raw_ptr() + region.offset, data_cursor, region.size);
+			data_cursor += region.size;
+		}
+	}
+
+	bool WorkloadsCheckpoint::save(const char* path) const
+	{
+		ROBOTICK_ASSERT_MSG(has_captured_data, "WorkloadsCheckpoint::save() without anything captured");
+
+		FileHeader header;
+		header.magic = MAGIC;
+		header.version = VERSION;
+		header.layout_hash = layout_hash;
+		header.data_hash = hash_data(data.raw_ptr(), data_size);
+		header.data_size = data_size;
+		header.frame_seq = frame_seq;
+
+		// write alongside, then rename over the old one - so a crash mid-write never leaves a torn checkpoint at path:
+		FixedString512 temp_path;
+		temp_path.format("%s.tmp", path);
+
+		FILE* file = ::fopen(temp_path.c_str(), "wb");
+		if (file == nullptr)
+		{
+			ROBOTICK_WARNING("WorkloadsCheckpoint: unable to open '%s' for writing", temp_path.c_str());
+			return false;
+		}
+
+		bool is_written = ::fwrite(&header, sizeof(header), 1, file) == 1;
+		if (is_written && data_size > 0)
+			is_written = ::fwrite(data.raw_ptr(), data_size, 1, file) == 1;
+		is_written = (::fclose(file) == 0) && is_written;
+
+		if (!is_written || ::rename(temp_path.c_str(), path) != 0)
+		{
+			ROBOTICK_WARNING("WorkloadsCheckpoint: unable to write checkpoint '%s'", path);
+			::remove(temp_path.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	bool WorkloadsCheckpoint::load(const char* path)
+	{
+		ROBOTICK_ASSERT_MSG(initialized, "WorkloadsCheckpoint::load() before initialize()");
+
+		FILE* file = ::fopen(path, "rb");
+		if (file == nullptr)
+			return false; // (nothing to restore is normal - e.g. a first run)
+
+		FileHeader header;
+		bool is_valid = ::fread(&header, sizeof(header), 1, file) == 1;
+		if (is_valid && (header.magic != MAGIC || header.version != VERSION))
+		{
+			ROBOTICK_WARNING("WorkloadsCheckpoint: '%s' is not a checkpoint (or is from an incompatible version)", path);
+			is_valid = false;
+		}
+		if (is_valid && (header.layout_hash != layout_hash || header.data_size != data_size))
+		{
+			ROBOTICK_WARNING("WorkloadsCheckpoint: '%s' was saved from a different model layout - ignoring it", path);
+			is_valid = false;
+		}
+
+		RawBuffer loaded_data;
+		if (is_valid && data_size > 0)
+		{
+			loaded_data = RawBuffer(data_size);
+			is_valid = ::fread(loaded_data.raw_ptr(), data_size, 1, file) == 1 && hash_data(loaded_data.raw_ptr(), data_size) == header.data_hash;
+			if (!is_valid)
+				ROBOTICK_WARNING("WorkloadsCheckpoint: '%s' is truncated or damaged - ignoring it", path);
+		}
+		::fclose(file);
+
+		if (!is_valid)
+			return false;
+
+		if (data_size > 0)
+			data = robotick::move(loaded_data);
+		frame_seq = header.frame_seq;
+		has_captured_data = true;
+		return true;
+	}
+
+} // namespace robotick
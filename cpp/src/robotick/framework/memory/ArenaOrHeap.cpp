@@ -0,0 +1,48 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/memory/ArenaOrHeap.h"
+
+#include "robotick/framework/memory/Memory.h"
+#include "robotick/framework/memory/MemoryArena.h"
+
+#include <new> // operator new/delete with alignment
+
+namespace robotick
+{
+	static bool is_heap_aligned(size_t alignment)
+	{
+		return alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	}
+
+	void* allocate_arena_or_heap(size_t size, size_t alignment, MemoryArena*& out_arena)
+	{
+		MemoryArena* arena = MemoryArena::get_current();
+		if (arena != nullptr && !arena->is_sealed())
+		{
+			out_arena = arena;
+			return arena->allocate(size, alignment);
+		}
+
+		out_arena = nullptr;
+		if (is_heap_aligned(alignment))
+			return ::operator new(size);
+		return ::operator new(size, robotick::align_val_t{alignment});
+	}
+
+	void release_arena_or_heap(void* ptr, size_t alignment, MemoryArena* arena)
+	{
+		if (ptr == nullptr)
+			return;
+
+		// (arena memory is reclaimed with the arena itself)
+		if (arena != nullptr)
+			return;
+
+		if (is_heap_aligned(alignment))
+			::operator delete(ptr);
+		else
+			::operator delete(ptr, robotick::align_val_t{alignment});
+	}
+
+} // namespace robotick
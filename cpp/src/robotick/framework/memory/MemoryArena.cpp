@@ -0,0 +1,142 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/memory/MemoryArena.h"
+
+#include <new>
+
+namespace robotick
+{
+	struct MemoryArena::Chunk
+	{
+		Chunk* next = nullptr;
+		size_t capacity = 0; // payload bytes, following this header
+		size_t used = 0;
+
+		uint8_t* payload() { return reinterpret_cast<uint8_t*>(this) + PAYLOAD_OFFSET; }
+		const uint8_t* payload() const { return reinterpret_cast<const uint8_t*>(this) + PAYLOAD_OFFSET; }
+
+		static constexpr size_t ALIGNMENT = alignof(max_align_t);
+		static constexpr size_t PAYLOAD_OFFSET = (sizeof(Chunk*) + 2 * sizeof(size_t) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	};
+
+	static thread_local MemoryArena* current_arena = nullptr;
+
+	MemoryArena::MemoryArena(size_t in_chunk_size)
+		: chunk_size(in_chunk_size)
+	{
+		ROBOTICK_ASSERT_MSG(chunk_size > 0, "MemoryArena: chunk size must be non-zero");
+	}
+
+	MemoryArena::~MemoryArena()
+	{
+		ROBOTICK_ASSERT_MSG(current_arena != this, "MemoryArena destroyed while still current on this thread");
+
+		Chunk* chunk = chunks;
+		while (chunk != nullptr)
+		{
+			Chunk* next = chunk->next;
+			chunk->~Chunk();
+			::operator delete(static_cast<void*>(chunk));
+			chunk = next;
+		}
+	}
+
+	MemoryArena::Chunk* MemoryArena::add_chunk(size_t min_payload_size)
+	{
+		const size_t payload_size = min_payload_size > chunk_size ? min_payload_size : chunk_size;
+
+		void* raw = ::operator new(Chunk::PAYLOAD_OFFSET + payload_size);
+		Chunk* chunk = new (raw) Chunk();
+		chunk->capacity = payload_size;
+
+		// (a chunk of its own for an oversized request sits behind the current one, so its remaining space isn't wasted)
+		if (chunks != nullptr && payload_size > chunk_size)
+		{
+			chunk->next = chunks->next;
+			chunks->next = chunk;
+		}
+		else
+		{
+			chunk->next = chunks;
+			chunks = chunk;
+		}
+
+		bytes_reserved += payload_size;
+		chunk_count++;
+		return chunk;
+	}
+
+	void* MemoryArena::allocate(size_t size, size_t alignment)
+	{
+		ROBOTICK_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0, "MemoryArena: alignment %zu not a power of two", alignment);
+
+		LockGuard lock(mutex);
+		if (sealed.is_set())
+			ROBOTICK_FATAL_EXIT("MemoryArena: allocation of %zu bytes after the arena was sealed", size);
+
+		if (size == 0)
+			size = 1; // (distinct allocations get distinct addresses, as with operator new)
+
+		auto try_allocate = [&](Chunk* chunk) -> void*
+		{
+			const uintptr_t cursor = reinterpret_cast<uintptr_t>(chunk->payload()) + chunk->used;
+			const uintptr_t aligned = (cursor + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+			const size_t padding = static_cast<size_t>(aligned - cursor);
+			if (padding + size > chunk->capacity - chunk->used)
+				return nullptr;
+
+			chunk->used += padding + size;
+			bytes_used += size;
+			return reinterpret_cast<void*>(aligned);
+		};
+
+		if (chunks != nullptr)
+		{
+			if (void* ptr = try_allocate(chunks))
+				return ptr;
+		}
+
+		// (over-aligned requests may need up to alignment - 1 bytes of padding, beyond the payload's own alignment)
+		const size_t padding_needed = alignment > Chunk::ALIGNMENT ? alignment - 1 : 0;
+		void* ptr = try_allocate(add_chunk(size + padding_needed));
+		ROBOTICK_ASSERT(ptr != nullptr);
+		return ptr;
+	}
+
+	void MemoryArena::seal()
+	{
+		LockGuard lock(mutex);
+		sealed.set();
+	}
+
+	bool MemoryArena::owns(const void* ptr) const
+	{
+		const uint8_t* byte_ptr = static_cast<const uint8_t*>(ptr);
+
+		LockGuard lock(mutex);
+		for (const Chunk* chunk = chunks; chunk != nullptr; chunk = chunk->next)
+		{
+			if (byte_ptr >= chunk->payload() && byte_ptr < chunk->payload() + chunk->capacity)
+				return true;
+		}
+		return false;
+	}
+
+	MemoryArena* MemoryArena::get_current()
+	{
+		return current_arena;
+	}
+
+	ScopedMemoryArena::ScopedMemoryArena(MemoryArena* arena)
+		: previous(current_arena)
+	{
+		current_arena = arena;
+	}
+
+	ScopedMemoryArena::~ScopedMemoryArena()
+	{
+		current_arena = previous;
+	}
+
+} // namespace robotick
@@ -6,7 +6,10 @@
 #include "robotick/api_base.h"
 #include "robotick/framework/model/DataConnectionSeed.h"
 #include "robotick/framework/model/RemoteModelSeed.h"
+#include "robotick/framework/model/WorkloadPlacementSeed.h"
 #include "robotick/framework/model/WorkloadSeed.h"
+#include "robotick/framework/model/WorkloadEnableSeed.h"
+#include "robotick/framework/model/WorkloadWatchdogSeed.h"
 #include "robotick/framework/strings/StringUtils.h"
 
 namespace robotick
@@ -53,6 +56,24 @@ namespace robotick
 		remote_models = ArrayView<const RemoteModelSeed*>(mutable_ptr, num_remote_model_seeds);
 	}
 
+	void Model::use_workload_placements(const WorkloadPlacementSeed* const* in_placements, size_t num_placements)
+	{
+		const WorkloadPlacementSeed** mutable_ptr = const_cast<const WorkloadPlacementSeed**>(in_placements);
+		workload_placements = ArrayView<const WorkloadPlacementSeed*>(mutable_ptr, num_placements);
+	}
+
+	void Model::use_workload_watchdogs(const WorkloadWatchdogSeed* const* in_watchdogs, size_t num_watchdogs)
+	{
+		const WorkloadWatchdogSeed** mutable_ptr = const_cast<const WorkloadWatchdogSeed**>(in_watchdogs);
+		workload_watchdogs = ArrayView<const WorkloadWatchdogSeed*>(mutable_ptr, num_watchdogs);
+	}
+
+	void Model::use_workload_enables(const WorkloadEnableSeed* const* in_enables, size_t num_enables)
+	{
+		const WorkloadEnableSeed** mutable_ptr = const_cast<const WorkloadEnableSeed**>(in_enables);
+		workload_enables = ArrayView<const WorkloadEnableSeed*>(mutable_ptr, num_enables);
+	}
+
 	void Model::set_root_workload(const WorkloadSeed& root, bool auto_finalize)
 	{
 		root_workload = &root;
@@ -68,6 +89,66 @@ namespace robotick
 		telemetry_port = in_telemetry_port;
 	}
 
+	void Model::set_worker_thread_count(const uint32_t in_worker_thread_count)
+	{
+		worker_thread_count = in_worker_thread_count;
+	}
+
+	void Model::set_tick_scheduling_mode(const TickSchedulingMode in_tick_scheduling_mode)
+	{
+		tick_scheduling_mode = in_tick_scheduling_mode;
+	}
+
+	void Model::set_overrun_policy(const OverrunPolicy in_overrun_policy)
+	{
+		overrun_policy = in_overrun_policy;
+	}
+
+	void Model::set_tick_timer_backend(const TickTimerBackend in_tick_timer_backend)
+	{
+		tick_timer_backend = in_tick_timer_backend;
+	}
+
+	void Model::set_parallel_load_enabled(const bool in_parallel_load_enabled)
+	{
+		parallel_load_enabled = in_parallel_load_enabled;
+	}
+
+	void Model::set_workloads_layout(const WorkloadsLayout in_workloads_layout)
+	{
+		workloads_layout = in_workloads_layout;
+	}
+
+	void Model::set_workloads_buffer_allocation(const WorkloadsBufferAllocation in_workloads_buffer_allocation)
+	{
+		workloads_buffer_allocation = in_workloads_buffer_allocation;
+	}
+
+	void Model::set_workloads_buffer_shared_memory_name(const char* in_shared_memory_name)
+	{
+		workloads_buffer_shared_memory_name = in_shared_memory_name;
+	}
+
+	void Model::set_snapshot_reader_count(const uint32_t in_snapshot_reader_count)
+	{
+		snapshot_reader_count = in_snapshot_reader_count;
+	}
+
+	void Model::set_dirty_region_tracking_enabled(const bool in_dirty_region_tracking_enabled)
+	{
+		dirty_region_tracking_enabled = in_dirty_region_tracking_enabled;
+	}
+
+	void Model::set_snapshot_dirty_copy_enabled(const bool in_snapshot_dirty_copy_enabled)
+	{
+		snapshot_dirty_copy_enabled = in_snapshot_dirty_copy_enabled;
+	}
+
+	void Model::set_state_arena_enabled(const bool in_state_arena_enabled)
+	{
+		state_arena_enabled = in_state_arena_enabled;
+	}
+
 	void Model::finalize()
 	{
 		if (!root_workload)
@@ -115,6 +196,107 @@ namespace robotick
 			}
 		}
 
+		// Validate any workload-placements:
+		for (size_t i = 0; i < workload_placements.size(); ++i)
+		{
+			const WorkloadPlacementSeed* placement = workload_placements[i];
+			const char* workload_name = placement->workload_name.c_str();
+
+			bool is_known_workload = false;
+			for (const WorkloadSeed* workload_seed : workload_seeds)
+			{
+				if (workload_seed->unique_name == workload_name)
+				{
+					is_known_workload = true;
+					break;
+				}
+			}
+
+			if (!is_known_workload)
+				ROBOTICK_FATAL_EXIT("Workload placement error: no workload named '%s'.", workload_name);
+
+			if (placement->core < -1 || placement->numa_node < -1)
+				ROBOTICK_FATAL_EXIT("Workload placement error: '%s' has an invalid core (%d) or NUMA node (%d).",
+					workload_name,
+					placement->core,
+					placement->numa_node);
+
+			for (size_t j = i + 1; j < workload_placements.size(); ++j)
+			{
+				if (workload_placements[j]->workload_name == workload_name)
+					ROBOTICK_FATAL_EXIT("Workload placement error: workload '%s' is placed more than once.", workload_name);
+			}
+		}
+
+		// Validate any workload-watchdogs:
+		for (size_t i = 0; i < workload_watchdogs.size(); ++i)
+		{
+			const WorkloadWatchdogSeed* watchdog = workload_watchdogs[i];
+			const char* workload_name = watchdog->workload_name.c_str();
+
+			bool is_known_workload = false;
+			for (const WorkloadSeed* workload_seed : workload_seeds)
+			{
+				if (workload_seed->unique_name == workload_name)
+				{
+					is_known_workload = true;
+					break;
+				}
+			}
+
+			if (!is_known_workload)
+				ROBOTICK_FATAL_EXIT("Workload watchdog error: no workload named '%s'.", workload_name);
+
+			if (!(watchdog->budget_ms > 0.0f))
+				ROBOTICK_FATAL_EXIT("Workload watchdog error: '%s' has an invalid budget (%.3f ms).", workload_name, watchdog->budget_ms);
+
+			for (size_t j = i + 1; j < workload_watchdogs.size(); ++j)
+			{
+				if (workload_watchdogs[j]->workload_name == workload_name)
+					ROBOTICK_FATAL_EXIT("Workload watchdog error: workload '%s' has more than one watchdog.", workload_name);
+			}
+		}
+
+		// Validate any workload-enables (their fields are resolved, and type-checked, by the Engine once laid out):
+		for (size_t i = 0; i < workload_enables.size(); ++i)
+		{
+			const WorkloadEnableSeed* enable = workload_enables[i];
+			const char* workload_name = enable->workload_name.c_str();
+
+			bool is_known_workload = false;
+			for (const WorkloadSeed* workload_seed : workload_seeds)
+			{
+				if (workload_seed->unique_name == workload_name)
+				{
+					is_known_workload = true;
+					break;
+				}
+			}
+
+			if (!is_known_workload)
+				ROBOTICK_FATAL_EXIT("Workload enable error: no workload named '%s'.", workload_name);
+
+			if (enable->enable_field_path.empty())
+				ROBOTICK_FATAL_EXIT("Workload enable error: '%s' has no enable field.", workload_name);
+
+			for (size_t j = i + 1; j < workload_enables.size(); ++j)
+			{
+				if (workload_enables[j]->workload_name == workload_name)
+					ROBOTICK_FATAL_EXIT("Workload enable error: workload '%s' has more than one enable field.", workload_name);
+			}
+		}
+
+		// Validate any instanced workloads:
+		for (const WorkloadSeed* workload_seed : workload_seeds)
+		{
+			if (workload_seed->instance_count == 0)
+				ROBOTICK_FATAL_EXIT("Workload error: '%s' has an instance_count of 0.", workload_seed->unique_name.c_str());
+
+			if (workload_seed->instance_count > 1 && (workload_seed->children.size() > 0 || workload_seed == root_workload))
+				ROBOTICK_FATAL_EXIT(
+					"Workload error: instanced workload '%s' cannot have children or be the root.", workload_seed->unique_name.c_str());
+		}
+
 		// Tick-rate validation
 		for (const auto* parent_workload : workload_seeds)
 		{
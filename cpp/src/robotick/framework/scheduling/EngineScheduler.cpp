@@ -0,0 +1,130 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/EngineScheduler.h"
+
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "robotick/framework/system/PlatformEvents.h"
+#include "robotick/framework/time/TickTimer.h"
+
+namespace robotick
+{
+	EngineScheduler::~EngineScheduler()
+	{
+		worker_pool.stop();
+
+		// don't leave engines (which may outlive us) pointing at our pool:
+		for (const ScheduledEngine& scheduled : engines)
+		{
+			TickPlan& tick_plan = scheduled.engine->get_tick_plan();
+			if (tick_plan.get_worker_pool() == &worker_pool)
+				tick_plan.set_worker_pool(nullptr);
+		}
+	}
+
+	void EngineScheduler::set_worker_thread_count(uint32_t in_worker_thread_count)
+	{
+		if (is_running)
+			ROBOTICK_FATAL_EXIT("EngineScheduler::set_worker_thread_count() called while running");
+
+		worker_thread_count = in_worker_thread_count;
+	}
+
+	void EngineScheduler::add_engine(Engine& engine)
+	{
+		if (is_running)
+			ROBOTICK_FATAL_EXIT("EngineScheduler::add_engine() called while running");
+
+		if (engine.get_root_instance_info() == nullptr)
+			ROBOTICK_FATAL_EXIT("EngineScheduler::add_engine() - engine must be loaded before it is added");
+
+		for (const ScheduledEngine& scheduled : engines)
+		{
+			if (scheduled.engine == &engine)
+				ROBOTICK_FATAL_EXIT("EngineScheduler::add_engine() - engine for model '%s' was already added", engine.get_model_name());
+		}
+
+		if (engines.size() >= engines.capacity())
+		{
+			ROBOTICK_FATAL_EXIT("EngineScheduler::add_engine() - cannot schedule more than %u engines (see DEFAULT_MAX_SCHEDULED_ENGINES)",
+				DEFAULT_MAX_SCHEDULED_ENGINES);
+		}
+
+		ScheduledEngine scheduled;
+		scheduled.engine = &engine;
+		engines.add(scheduled);
+
+		// engines without a pool of their own share ours (it runs their groups inline whenever we have no workers):
+		if (engine.get_worker_pool() == nullptr)
+			engine.get_tick_plan().set_worker_pool(&worker_pool);
+	}
+
+	void EngineScheduler::step_engine_task(void* context, uint32_t index)
+	{
+		ScheduledEngine& scheduled = static_cast<EngineScheduler*>(context)->engines[index];
+		scheduled.next_tick_time = scheduled.engine->step();
+	}
+
+	void EngineScheduler::run(const AtomicFlag& stop_after_next_tick_flag)
+	{
+		if (engines.empty())
+			ROBOTICK_FATAL_EXIT("EngineScheduler::run() called with no engines added");
+
+		is_running = true;
+		worker_pool.start(worker_thread_count);
+
+		for (uint32_t index = 0; index < engines.size(); ++index)
+		{
+			step_tasks[index].fn = &EngineScheduler::step_engine_task;
+			step_tasks[index].context = this;
+			step_tasks[index].index = index;
+
+			engines[index].next_tick_time = engines[index].engine->begin_stepped_run(&stop_after_next_tick_flag);
+		}
+
+		TickTimer tick_timer;
+		tick_timer.start(tick_timer_backend);
+
+		bool is_stop_requested = false;
+		do
+		{
+			Clock::time_point earliest_tick_time = engines[0].next_tick_time;
+			for (const ScheduledEngine& scheduled : engines)
+			{
+				if (scheduled.next_tick_time < earliest_tick_time)
+					earliest_tick_time = scheduled.next_tick_time;
+			}
+
+			// cut short by the stop flag (or an engine's stop()), in which case nothing is due yet and the loop condition decides:
+			if (tick_timer.sleep_until_or_woken(earliest_tick_time, stop_after_next_tick_flag))
+			{
+				// tick everything now due - including any engine whose deadline passed while we were waking for the earliest:
+				const auto now = Clock::now();
+				size_t due_count = 0;
+				for (uint32_t index = 0; index < engines.size(); ++index)
+				{
+					if (engines[index].next_tick_time <= now)
+						due_tasks[due_count++] = &step_tasks[index];
+				}
+
+				worker_pool.run_and_wait(due_tasks, due_count);
+			}
+
+			// an engine asked to stop (by stop() or its watchdog) stops them all (they were started together, so are stopped together):
+			for (const ScheduledEngine& scheduled : engines)
+				is_stop_requested = is_stop_requested || scheduled.engine->is_stop_requested();
+
+		} while (!stop_after_next_tick_flag.is_set() && !should_exit_application() && !is_stop_requested);
+
+		for (const ScheduledEngine& scheduled : engines)
+		{
+			scheduled.engine->end_stepped_run();
+		}
+
+		worker_pool.stop();
+		is_running = false;
+	}
+
+} // namespace robotick
@@ -0,0 +1,1123 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/TickPlan.h"
+
+#include "robotick/api_base.h"
+#include "robotick/framework/WorkloadInstanceInfo.h"
+#include "robotick/framework/data/DataConnection.h"
+#include "robotick/framework/data/DirtyRegionTracker.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/model/WorkloadPlacementSeed.h"
+#include "robotick/framework/model/WorkloadSeed.h"
+#include "robotick/framework/registry/TypeDescriptor.h"
+#include "robotick/framework/time/Clock.h"
+
+#include <stdio.h>
+
+namespace robotick
+{
+	namespace
+	{
+		uint32_t count_subtree_entries(const WorkloadInstanceInfo& instance)
+		{
+			uint32_t count = 1;
+			for (const WorkloadInstanceInfo* child : instance.children)
+			{
+				ROBOTICK_ASSERT(child != nullptr);
+				count += count_subtree_entries(*child);
+			}
+			return count;
+		}
+
+		// Children may only tick at (or slower than) their parent's rate - Model::finalize() enforces this - so the divisor is
+		// the whole number of parent ticks between child ticks. Non-integer ratios are rounded to the nearest divisor.
+		uint32_t compute_tick_rate_divisor(float parent_tick_rate_hz, float child_tick_rate_hz)
+		{
+			if (parent_tick_rate_hz <= 0.0f || child_tick_rate_hz <= 0.0f || child_tick_rate_hz >= parent_tick_rate_hz)
+				return 1;
+
+			const uint32_t divisor = static_cast<uint32_t>(parent_tick_rate_hz / child_tick_rate_hz + 0.5f);
+			return divisor > 0 ? divisor : 1;
+		}
+
+		uint64_t greatest_common_divisor(uint64_t a, uint64_t b)
+		{
+			while (b != 0)
+			{
+				const uint64_t remainder = a % b;
+				a = b;
+				b = remainder;
+			}
+			return a;
+		}
+
+		// The first of the sorted values in [begin, end) that is at least value (or end, if none are)
+		const uint32_t* find_first_at_least(const uint32_t* begin, const uint32_t* end, uint32_t value)
+		{
+			while (begin < end)
+			{
+				const uint32_t* middle = begin + (end - begin) / 2;
+				if (*middle < value)
+					begin = middle + 1;
+				else
+					end = middle;
+			}
+			return begin;
+		}
+	} // namespace
+
+	void TickPlan::compile(const WorkloadInstanceInfo& root, const HeapVector<WorkloadInstanceInfo>& instances, WorkloadsBuffer& workloads_buffer)
+	{
+		if (is_compiled())
+			ROBOTICK_FATAL_EXIT("TickPlan has already been compiled");
+
+		instances_begin = instances.data();
+
+		entry_index_by_instance.initialize(instances.size());
+		for (uint32_t& entry_index : entry_index_by_instance)
+			entry_index = TickPlanEntry::INVALID_INDEX;
+
+		entries.initialize(count_subtree_entries(root));
+
+		uint32_t cursor = 0;
+		append_subtree(root, TickPlanEntry::INVALID_INDEX, cursor, workloads_buffer);
+		ROBOTICK_ASSERT(cursor == entries.size());
+
+		// give each parent its own slice of the batch scratch, so nested groups never overwrite a batch still being submitted:
+		uint32_t child_batch_cursor = 0;
+		for (TickPlanEntry& entry : entries)
+		{
+			entry.child_batch_begin = child_batch_cursor;
+			child_batch_cursor += static_cast<uint32_t>(entry.instance_info->children.size());
+		}
+
+		enable_mask.initialize((entries.size() + 63) / 64);
+		for (uint64_t& mask_word : enable_mask)
+			mask_word = ~0ull;
+
+		child_tasks.initialize(entries.size());
+		child_task_batch.initialize(child_batch_cursor);
+		for (uint32_t index = 0; index < entries.size(); ++index)
+		{
+			child_tasks[index].fn = &TickPlan::run_child_task;
+			child_tasks[index].context = this;
+			child_tasks[index].index = index;
+		}
+
+		// subtrees placed on threads of their own (the root's placement is applied by the Engine, to the thread running it):
+		uint32_t dedicated_thread_count = 0;
+		for (TickPlanEntry& entry : entries)
+		{
+			const WorkloadPlacementSeed* placement = entry.instance_info->placement;
+			const bool has_parent = entry.parent_index != TickPlanEntry::INVALID_INDEX;
+
+			if (has_parent && placement != nullptr && placement->has_dedicated_thread())
+				entry.dedicated_thread_index = dedicated_thread_count++;
+
+			// pre-order, so the parent's thread is already known:
+			if (entry.dedicated_thread_index != TickPlanEntry::INVALID_INDEX)
+				entry.thread_index = entry.dedicated_thread_index;
+			else if (has_parent)
+				entry.thread_index = entries[entry.parent_index].thread_index;
+		}
+
+		if (dedicated_thread_count > 0)
+		{
+			dedicated_threads.initialize(dedicated_thread_count);
+			for (uint32_t index = 0; index < entries.size(); ++index)
+			{
+				const TickPlanEntry& entry = entries[index];
+				if (entry.dedicated_thread_index == TickPlanEntry::INVALID_INDEX)
+					continue;
+
+				TickPlanDedicatedThread& dedicated = dedicated_threads[entry.dedicated_thread_index];
+				dedicated.plan = this;
+				dedicated.entry_index = index;
+				dedicated.core = entry.instance_info->placement->core;
+			}
+		}
+	}
+
+	void TickPlan::append_subtree(
+		const WorkloadInstanceInfo& instance, uint32_t parent_index, uint32_t& cursor, WorkloadsBuffer& workloads_buffer)
+	{
+		const size_t instance_index = static_cast<size_t>(&instance - instances_begin);
+		ROBOTICK_ASSERT_MSG(instance_index < entry_index_by_instance.size(), "TickPlan: workload instance is not owned by the Engine");
+
+		if (entry_index_by_instance[instance_index] != TickPlanEntry::INVALID_INDEX)
+			ROBOTICK_FATAL_EXIT("Workload '%s' appears more than once in the workload tree", instance.seed->unique_name.c_str());
+
+		const uint32_t index = cursor++;
+		entry_index_by_instance[instance_index] = index;
+
+		TickPlanEntry& entry = entries[index];
+		entry.tick_fn = instance.workload_descriptor->tick_fn;
+		entry.async_tick_fn = instance.workload_descriptor->async_tick_fn;
+		entry.tick_batch_fn = instance.workload_descriptor->tick_batch_fn;
+		entry.has_work_fn = instance.workload_descriptor->has_work_fn;
+		entry.instance_count = instance.instance_count;
+		entry.instance_ptr = instance.get_ptr(workloads_buffer);
+		if (instance.workload_descriptor->outputs_desc != nullptr)
+		{
+			const size_t element_size = instance.get_size() / instance.instance_count;
+			entry.outputs_ptr = static_cast<uint8_t*>(entry.instance_ptr) + instance.workload_descriptor->outputs_offset;
+			entry.outputs_size = element_size * (instance.instance_count - 1) + instance.workload_descriptor->outputs_desc->size;
+		}
+		entry.workload_stats = instance.workload_stats;
+		entry.instance_info = &instance;
+		entry.parent_index = parent_index;
+		entry.is_event_driven = instance.workload_descriptor->is_event_driven;
+
+		if (instance.watchdog != nullptr)
+		{
+			entry.watchdog_budget_ns = static_cast<uint64_t>(static_cast<double>(instance.watchdog->budget_ms) * 1e6);
+			entry.watchdog_action = instance.watchdog->action;
+		}
+
+		// a child without its own tick-rate simply ticks whenever its parent does:
+		const float parent_tick_rate_hz = (parent_index != TickPlanEntry::INVALID_INDEX) ? entries[parent_index].tick_rate_hz : 0.0f;
+		const float seed_tick_rate_hz = instance.seed->tick_rate_hz;
+		entry.tick_rate_hz = (seed_tick_rate_hz > 0.0f) ? seed_tick_rate_hz : parent_tick_rate_hz;
+		entry.tick_rate_divisor = compute_tick_rate_divisor(parent_tick_rate_hz, entry.tick_rate_hz);
+		entry.tick_budget_ns =
+			(entry.tick_rate_hz > 0.0f) ? detail::clamp_to_uint32(Clock::to_nanoseconds(Clock::from_seconds(1.0f / entry.tick_rate_hz)).count()) : 0;
+
+		for (const WorkloadInstanceInfo* child : instance.children)
+		{
+			append_subtree(*child, index, cursor, workloads_buffer);
+		}
+
+		entry.subtree_end = cursor;
+	}
+
+	void TickPlan::bind_connections(HeapVector<DataConnectionInfo>& all_connections)
+	{
+		ROBOTICK_ASSERT_MSG(is_compiled(), "TickPlan::bind_connections() called before compile()");
+
+		// returns the entry consuming this connection, or INVALID_INDEX if the plan is not responsible for applying it:
+		const auto find_consumer_entry = [&](const DataConnectionInfo& conn) -> uint32_t
+		{
+			if (conn.dest_workload == nullptr)
+				return TickPlanEntry::INVALID_INDEX;
+
+			const uint32_t consumer_index = find_entry_index(*conn.dest_workload);
+			if (consumer_index == TickPlanEntry::INVALID_INDEX)
+				return TickPlanEntry::INVALID_INDEX;
+
+			const uint32_t parent_index = entries[consumer_index].parent_index;
+			if (parent_index == TickPlanEntry::INVALID_INDEX)
+				return TickPlanEntry::INVALID_INDEX;
+
+			return consumer_index;
+		};
+
+		// claim connections that no group has taken ownership of, where the consumer's parent is sequenced by the plan itself:
+		for (DataConnectionInfo& conn : all_connections)
+		{
+			if (conn.expected_handler != DataConnectionInfo::ExpectedHandler::Unassigned)
+				continue;
+
+			const uint32_t consumer_index = find_consumer_entry(conn);
+			if (consumer_index != TickPlanEntry::INVALID_INDEX && entries[entries[consumer_index].parent_index].is_engine_sequenced())
+				conn.expected_handler = DataConnectionInfo::ExpectedHandler::Engine;
+		}
+
+		const auto is_applied_by_plan = [](const DataConnectionInfo& conn)
+		{
+			return conn.expected_handler == DataConnectionInfo::ExpectedHandler::Engine ||
+				   conn.expected_handler == DataConnectionInfo::ExpectedHandler::SequencedGroupWorkload;
+		};
+
+		// count-then-fill so each entry's connections end up contiguous:
+		size_t total_connections = 0;
+		for (const DataConnectionInfo& conn : all_connections)
+		{
+			const uint32_t consumer_index = find_consumer_entry(conn);
+			if (consumer_index != TickPlanEntry::INVALID_INDEX && is_applied_by_plan(conn))
+			{
+				entries[consumer_index].connections_count++;
+				total_connections++;
+			}
+		}
+
+		uint32_t connections_begin = 0;
+		for (TickPlanEntry& entry : entries)
+		{
+			entry.connections_begin = connections_begin;
+			connections_begin += entry.connections_count;
+			entry.connections_count = 0;
+		}
+
+		connections.initialize(total_connections);
+
+		for (const DataConnectionInfo& conn : all_connections)
+		{
+			const uint32_t consumer_index = find_consumer_entry(conn);
+			if (consumer_index != TickPlanEntry::INVALID_INDEX && is_applied_by_plan(conn))
+			{
+				TickPlanEntry& entry = entries[consumer_index];
+				connections[entry.connections_begin + entry.connections_count] = &conn;
+				entry.connections_count++;
+			}
+		}
+	}
+
+	void TickPlan::build_dataflow_levels()
+	{
+		ROBOTICK_ASSERT_MSG(is_compiled(), "TickPlan::build_dataflow_levels() called before compile()");
+
+		if (!dataflow_levels.empty())
+			ROBOTICK_FATAL_EXIT("TickPlan dataflow levels have already been built");
+
+		// every direct child of an engine-sequenced entry is placed in exactly one level, so this bounds both arrays:
+		uint32_t total_children = 0;
+		for (const TickPlanEntry& entry : entries)
+		{
+			if (entry.is_engine_sequenced())
+				total_children += static_cast<uint32_t>(entry.instance_info->children.size());
+		}
+
+		dataflow_levels.initialize(total_children);
+		dataflow_level_entries.initialize(total_children);
+
+		// which of its parent's children each entry sits under (filled in for each parent's subtree in turn):
+		HeapVector<uint32_t> local_index_by_entry;
+		local_index_by_entry.initialize(entries.size());
+
+		uint32_t levels_cursor = 0;
+		uint32_t level_entries_cursor = 0;
+
+		for (uint32_t parent_index = 0; parent_index < entries.size(); ++parent_index)
+		{
+			TickPlanEntry& parent = entries[parent_index];
+			const uint32_t child_count = static_cast<uint32_t>(parent.instance_info->children.size());
+			if (!parent.is_engine_sequenced() || child_count == 0)
+				continue;
+
+			// number this parent's direct children locally (0..child_count-1), in model order:
+			HeapVector<uint32_t> child_entry_indices;
+			child_entry_indices.initialize(child_count);
+			{
+				uint32_t local_index = 0;
+				for (uint32_t index = parent_index + 1; index < parent.subtree_end; index = entries[index].subtree_end)
+				{
+					for (uint32_t descendant = index; descendant < entries[index].subtree_end; ++descendant)
+						local_index_by_entry[descendant] = local_index;
+
+					child_entry_indices[local_index++] = index;
+				}
+			}
+
+			// an edge runs from the sibling subtree producing a connection's source to the sibling consuming it:
+			const auto find_producer_local = [&](const DataConnectionInfo& conn, uint32_t consumer_local) -> uint32_t
+			{
+				const uint32_t source_entry_index =
+					conn.source_workload ? find_entry_index(*conn.source_workload) : TickPlanEntry::INVALID_INDEX;
+				if (source_entry_index == TickPlanEntry::INVALID_INDEX)
+					return TickPlanEntry::INVALID_INDEX; // produced outside the plan - nothing to wait for
+
+				if (source_entry_index <= parent_index || source_entry_index >= parent.subtree_end)
+					return TickPlanEntry::INVALID_INDEX; // produced outside this parent
+
+				// (fed back into the same subtree from its previous tick - nothing to wait for either)
+				const uint32_t producer_local = local_index_by_entry[source_entry_index];
+				return producer_local != consumer_local ? producer_local : TickPlanEntry::INVALID_INDEX;
+			};
+
+			// each producer's consumers, in one array indexed by per-producer offsets:
+			HeapVector<uint32_t> in_degree;
+			in_degree.initialize(child_count);
+			HeapVector<uint32_t> consumers_begin;
+			consumers_begin.initialize(child_count + 1);
+
+			uint32_t edge_count = 0;
+			for (uint32_t consumer_local = 0; consumer_local < child_count; ++consumer_local)
+			{
+				const TickPlanEntry& consumer = entries[child_entry_indices[consumer_local]];
+				for (uint32_t i = 0; i < consumer.connections_count; ++i)
+				{
+					const uint32_t producer_local = find_producer_local(*connections[consumer.connections_begin + i], consumer_local);
+					if (producer_local == TickPlanEntry::INVALID_INDEX)
+						continue;
+
+					consumers_begin[producer_local + 1]++;
+					in_degree[consumer_local]++;
+					edge_count++;
+				}
+			}
+
+			for (uint32_t local_index = 0; local_index < child_count; ++local_index)
+				consumers_begin[local_index + 1] += consumers_begin[local_index];
+
+			HeapVector<uint32_t> consumers;
+			consumers.initialize(edge_count);
+			HeapVector<uint32_t> consumers_filled;
+			consumers_filled.initialize(child_count);
+			for (uint32_t consumer_local = 0; consumer_local < child_count; ++consumer_local)
+			{
+				const TickPlanEntry& consumer = entries[child_entry_indices[consumer_local]];
+				for (uint32_t i = 0; i < consumer.connections_count; ++i)
+				{
+					const uint32_t producer_local = find_producer_local(*connections[consumer.connections_begin + i], consumer_local);
+					if (producer_local != TickPlanEntry::INVALID_INDEX)
+						consumers[consumers_begin[producer_local] + consumers_filled[producer_local]++] = consumer_local;
+				}
+			}
+
+			// Kahn's algorithm, assigning each child the level after its latest producer:
+			HeapVector<uint32_t> levels;
+			levels.initialize(child_count);
+			HeapVector<uint32_t> ready;
+			ready.initialize(child_count);
+			uint32_t ready_begin = 0;
+			uint32_t ready_end = 0;
+			for (uint32_t local_index = 0; local_index < child_count; ++local_index)
+			{
+				if (in_degree[local_index] == 0)
+					ready[ready_end++] = local_index;
+			}
+
+			uint32_t level_count = 0;
+			while (ready_begin < ready_end)
+			{
+				const uint32_t producer = ready[ready_begin++];
+				if (levels[producer] + 1 > level_count)
+					level_count = levels[producer] + 1;
+
+				for (uint32_t edge = consumers_begin[producer]; edge < consumers_begin[producer + 1]; ++edge)
+				{
+					const uint32_t consumer_local = consumers[edge];
+					if (levels[consumer_local] < levels[producer] + 1)
+						levels[consumer_local] = levels[producer] + 1;
+
+					if (--in_degree[consumer_local] == 0)
+						ready[ready_end++] = consumer_local;
+				}
+			}
+
+			if (ready_end < child_count)
+			{
+				for (uint32_t local_index = 0; local_index < child_count; ++local_index)
+				{
+					if (in_degree[local_index] > 0)
+						ROBOTICK_WARNING(
+							"Dataflow cycle member: '%s'", entries[child_entry_indices[local_index]].instance_info->seed->unique_name.c_str());
+				}
+				ROBOTICK_FATAL_EXIT("Data-connections between the children of '%s' form a cycle - cannot build dataflow levels",
+					parent.instance_info->seed->unique_name.c_str());
+			}
+
+			// bucket children by level - a counting sort, so model order is kept within each level:
+			parent.dataflow_levels_begin = levels_cursor;
+			parent.dataflow_levels_count = level_count;
+			for (uint32_t local_index = 0; local_index < child_count; ++local_index)
+				dataflow_levels[levels_cursor + levels[local_index]].count++;
+
+			for (uint32_t level = 0; level < level_count; ++level)
+			{
+				TickPlanDataflowLevel& dataflow_level = dataflow_levels[levels_cursor + level];
+				dataflow_level.begin = level_entries_cursor;
+				level_entries_cursor += dataflow_level.count;
+				dataflow_level.count = 0;
+			}
+
+			for (uint32_t local_index = 0; local_index < child_count; ++local_index)
+			{
+				TickPlanDataflowLevel& dataflow_level = dataflow_levels[levels_cursor + levels[local_index]];
+				dataflow_level_entries[dataflow_level.begin + dataflow_level.count++] = child_entry_indices[local_index];
+			}
+			levels_cursor += level_count;
+
+			ROBOTICK_INFO("Dataflow schedule for '%s': %u children in %u levels",
+				parent.instance_info->seed->unique_name.c_str(),
+				child_count,
+				level_count);
+		}
+	}
+
+	void TickPlan::build_hyperperiod_table()
+	{
+		ROBOTICK_ASSERT_MSG(is_compiled(), "TickPlan::build_hyperperiod_table() called before compile()");
+
+		if (hyperperiod_slot_count > 0)
+			ROBOTICK_FATAL_EXIT("TickPlan hyperperiod table has already been built");
+
+		// slots run everything on the tick thread, so there would be nowhere to hand a dedicated subtree off from:
+		if (!dedicated_threads.empty())
+			ROBOTICK_FATAL_EXIT("Dedicated-thread workload placements are not supported with TickSchedulingMode::Hyperperiod");
+
+		TickPlanEntry& root = entries[0];
+		if (!root.is_engine_sequenced())
+		{
+			ROBOTICK_WARNING("Hyperperiod scheduling ignored - root workload '%s' ticks its own children",
+				root.instance_info->seed->unique_name.c_str());
+			return;
+		}
+
+		// 1) root-relative divisor of every entry reached purely through plan-sequenced parents, and their least common multiple:
+		root.hyperperiod_divisor = 1;
+		root.hyperperiod_phase = 0;
+
+		uint64_t hyperperiod = 1;
+		uint32_t scheduled_count = 0;
+
+		for (uint32_t index = 1; index < entries.size(); ++index)
+		{
+			TickPlanEntry& entry = entries[index];
+			const TickPlanEntry& parent = entries[entry.parent_index];
+			if (parent.hyperperiod_divisor == 0 || !parent.is_engine_sequenced())
+				continue; // ticked by a group workload (or beneath one) - its own rate counter still applies
+
+			const uint64_t divisor = static_cast<uint64_t>(parent.hyperperiod_divisor) * entry.tick_rate_divisor;
+			hyperperiod = (hyperperiod / greatest_common_divisor(hyperperiod, divisor)) * divisor;
+
+			if (hyperperiod > DEFAULT_MAX_HYPERPERIOD_SLOTS)
+			{
+				ROBOTICK_FATAL_EXIT("Hyperperiod of the model's tick-rates exceeds %u root ticks (reached at '%s', which ticks every %llu root ticks)"
+									" - choose rates with a smaller common multiple or use TickSchedulingMode::Sequenced",
+					DEFAULT_MAX_HYPERPERIOD_SLOTS,
+					entry.instance_info->seed->unique_name.c_str(),
+					static_cast<unsigned long long>(divisor));
+			}
+
+			entry.hyperperiod_divisor = static_cast<uint32_t>(divisor);
+			scheduled_count++;
+		}
+
+		const uint32_t slot_count = static_cast<uint32_t>(hyperperiod);
+
+		// containers occupy slots too (just ahead of their children), to apply their connections and record their own ticks:
+		const auto is_slotted = [&](const TickPlanEntry& entry)
+		{ return entry.hyperperiod_divisor != 0 && entry.parent_index != TickPlanEntry::INVALID_INDEX; };
+
+		// 2) phase offsets: fastest entries first (parents always precede their children, whose divisors are multiples of
+		// theirs), each slower entry taking whichever of its allowed phases keeps the busiest slot it lands in the lightest:
+		HeapVector<uint32_t> placement_order;
+		placement_order.initialize(scheduled_count);
+		{
+			uint32_t placed = 0;
+			for (uint32_t index = 1; index < entries.size(); ++index)
+			{
+				if (entries[index].hyperperiod_divisor == 0)
+					continue;
+
+				// stable insertion by divisor, so equal rates keep pre-order:
+				uint32_t insert_at = placed++;
+				while (insert_at > 0 && entries[placement_order[insert_at - 1]].hyperperiod_divisor > entries[index].hyperperiod_divisor)
+				{
+					placement_order[insert_at] = placement_order[insert_at - 1];
+					insert_at--;
+				}
+				placement_order[insert_at] = index;
+			}
+		}
+
+		HeapVector<uint32_t> slot_load;
+		slot_load.initialize(slot_count);
+
+		for (const uint32_t index : placement_order)
+		{
+			TickPlanEntry& entry = entries[index];
+			const TickPlanEntry& parent = entries[entry.parent_index];
+
+			// the entry can only tick on its parent's ticks, so each local phase is a whole number of parent periods in:
+			uint32_t best_phase = parent.hyperperiod_phase;
+			uint32_t best_peak_load = 0xFFFFFFFFu;
+			for (uint32_t local_phase = 0; local_phase < entry.tick_rate_divisor; ++local_phase)
+			{
+				const uint32_t phase = parent.hyperperiod_phase + local_phase * parent.hyperperiod_divisor;
+
+				uint32_t peak_load = 0;
+				for (uint32_t slot = phase; slot < slot_count; slot += entry.hyperperiod_divisor)
+				{
+					if (slot_load[slot] > peak_load)
+						peak_load = slot_load[slot];
+				}
+
+				if (peak_load < best_peak_load)
+				{
+					best_peak_load = peak_load;
+					best_phase = phase;
+				}
+			}
+
+			entry.hyperperiod_phase = best_phase;
+
+			if (entry.has_tick())
+			{
+				for (uint32_t slot = best_phase; slot < slot_count; slot += entry.hyperperiod_divisor)
+					slot_load[slot]++;
+			}
+		}
+
+		// 3) count-then-fill the slot table, walking entries in pre-order so each slot keeps model order:
+		hyperperiod_slot_offsets.initialize(slot_count + 1);
+
+		for (const TickPlanEntry& entry : entries)
+		{
+			if (!is_slotted(entry))
+				continue;
+
+			for (uint32_t slot = entry.hyperperiod_phase; slot < slot_count; slot += entry.hyperperiod_divisor)
+				hyperperiod_slot_offsets[slot + 1]++;
+		}
+
+		for (uint32_t slot = 0; slot < slot_count; ++slot)
+			hyperperiod_slot_offsets[slot + 1] += hyperperiod_slot_offsets[slot];
+
+		hyperperiod_slot_entries.initialize(hyperperiod_slot_offsets[slot_count]);
+
+		HeapVector<uint32_t> slot_fill;
+		slot_fill.initialize(slot_count);
+
+		for (uint32_t index = 0; index < entries.size(); ++index)
+		{
+			const TickPlanEntry& entry = entries[index];
+			if (!is_slotted(entry))
+				continue;
+
+			for (uint32_t slot = entry.hyperperiod_phase; slot < slot_count; slot += entry.hyperperiod_divisor)
+				hyperperiod_slot_entries[hyperperiod_slot_offsets[slot] + slot_fill[slot]++] = index;
+		}
+
+		hyperperiod_slot_count = slot_count;
+
+		uint32_t busiest_slot_load = 0;
+		for (const uint32_t load : slot_load)
+		{
+			if (load > busiest_slot_load)
+				busiest_slot_load = load;
+		}
+
+		ROBOTICK_INFO("Hyperperiod schedule for '%s': %u workloads over %u slots (busiest slot ticks %u)",
+			root.instance_info->seed->unique_name.c_str(),
+			scheduled_count,
+			slot_count,
+			busiest_slot_load);
+	}
+
+	void TickPlan::start()
+	{
+		stop();
+
+		hyperperiod_slot_cursor = 0;
+
+		for (uint32_t index = 0; index < entries.size(); ++index)
+		{
+			TickPlanEntry& entry = entries[index];
+			entry.ticks_until_due = 0;
+			entry.last_delta_ns = 0;
+			entry.has_pending_event = true; // event-driven workloads still get one initial tick
+			entry.is_awaiting_io = false;
+			entry.watchdog_tick_start_ns.store(0);
+			entry.is_watchdog_skipping.clear();
+			entry.tick_info = TickInfo{};
+			entry.tick_info.tick_rate_hz = entry.tick_rate_hz;
+			entry.tick_info.workload_stats = entry.workload_stats;
+
+			// (workloads ticked on the worker pool have no one ticking thread - they are started here, on the caller's)
+			if (entry.thread_index == TickPlanEntry::INVALID_INDEX)
+				start_entry(index);
+		}
+
+		// dedicated threads start their own subtrees (see dedicated_thread_entry), and must have done so before the first tick:
+		for (uint32_t thread_index = 0; thread_index < dedicated_threads.size(); ++thread_index)
+		{
+			TickPlanDedicatedThread& dedicated = dedicated_threads[thread_index];
+			dedicated.has_tick_pending = false;
+			dedicated.is_stopping = false;
+			dedicated.has_exited = false;
+
+			char thread_name[16];
+			::snprintf(thread_name, sizeof(thread_name), "robotick-ded%u", thread_index);
+			dedicated.thread = Thread(&TickPlan::dedicated_thread_entry, &dedicated, thread_name, dedicated.core);
+		}
+
+		for (TickPlanDedicatedThread& dedicated : dedicated_threads)
+		{
+			UniqueLock lock(dedicated.mutex);
+			dedicated.condition.wait(lock, [&]() { return dedicated.is_started; });
+		}
+	}
+
+	void TickPlan::stop()
+	{
+		for (TickPlanDedicatedThread& dedicated : dedicated_threads)
+		{
+			{
+				LockGuard lock(dedicated.mutex);
+				if (!dedicated.is_started)
+					continue;
+
+				dedicated.is_stopping = true;
+			}
+			dedicated.condition.notify_all();
+
+			if (dedicated.thread.is_joining_supported())
+			{
+				dedicated.thread.join();
+			}
+			else
+			{
+				// platforms without join support (e.g. FreeRTOS tasks) signal their exit instead:
+				UniqueLock lock(dedicated.mutex);
+				dedicated.condition.wait(lock, [&]() { return dedicated.has_exited; });
+			}
+
+			dedicated.is_started = false;
+		}
+	}
+
+	void TickPlan::start_entry(uint32_t index)
+	{
+		const TickPlanEntry& entry = entries[index];
+
+		// the root is started by the Engine, and children of groups with their own tick_fn are started by those groups:
+		const bool is_started_by_plan = entry.parent_index != TickPlanEntry::INVALID_INDEX && entries[entry.parent_index].is_engine_sequenced();
+		const auto start_fn = entry.instance_info->workload_descriptor->start_fn;
+		if (is_started_by_plan && start_fn)
+			entry.instance_info->for_each_element(
+				static_cast<uint8_t*>(entry.instance_ptr), [&](uint8_t* element_ptr) { start_fn(element_ptr, entry.tick_rate_hz); });
+	}
+
+	void TickPlan::dedicated_thread_entry(void* arg)
+	{
+		TickPlanDedicatedThread& dedicated = *static_cast<TickPlanDedicatedThread*>(arg);
+		TickPlan& plan = *dedicated.plan;
+
+		// start_fn runs on the thread that will tick the workload, so it can safely cache thread-affine handles:
+		const TickPlanEntry& top = plan.entries[dedicated.entry_index];
+		for (uint32_t index = dedicated.entry_index; index < top.subtree_end; ++index)
+		{
+			if (plan.entries[index].thread_index == top.thread_index)
+				plan.start_entry(index);
+		}
+
+		UniqueLock lock(dedicated.mutex);
+		dedicated.is_started = true;
+		dedicated.condition.notify_all();
+
+		while (true)
+		{
+			dedicated.condition.wait(lock, [&]() { return dedicated.has_tick_pending || dedicated.is_stopping; });
+			if (!dedicated.has_tick_pending)
+				break;
+
+			lock.unlock();
+			plan.run_child(dedicated.entry_index);
+			lock.lock();
+
+			dedicated.has_tick_pending = false;
+			dedicated.condition.notify_all();
+		}
+
+		// the watchdog mustn't signal this thread once it's gone:
+		for (uint32_t index = dedicated.entry_index; index < top.subtree_end; ++index)
+		{
+			if (plan.entries[index].thread_index == top.thread_index)
+				plan.entries[index].watchdog_tick_thread.store(0);
+		}
+
+		dedicated.has_exited = true;
+		dedicated.condition.notify_all();
+	}
+
+	bool TickPlan::launch_child(uint32_t index)
+	{
+		const uint32_t dedicated_thread_index = entries[index].dedicated_thread_index;
+		if (dedicated_thread_index != TickPlanEntry::INVALID_INDEX)
+		{
+			TickPlanDedicatedThread& dedicated = dedicated_threads[dedicated_thread_index];
+			{
+				LockGuard lock(dedicated.mutex);
+				if (dedicated.is_started)
+				{
+					dedicated.has_tick_pending = true;
+					dedicated.condition.notify_all();
+					return true;
+				}
+			}
+		}
+
+		// (a dedicated thread that isn't running - e.g. before start() - ticks its subtree inline instead)
+		run_child(index);
+		return false;
+	}
+
+	void TickPlan::wait_for_dedicated_children(uint32_t parent_index)
+	{
+		const uint32_t subtree_end = entries[parent_index].subtree_end;
+
+		uint32_t index = parent_index + 1;
+		while (index < subtree_end)
+		{
+			const uint32_t dedicated_thread_index = entries[index].dedicated_thread_index;
+			if (dedicated_thread_index != TickPlanEntry::INVALID_INDEX)
+			{
+				TickPlanDedicatedThread& dedicated = dedicated_threads[dedicated_thread_index];
+				UniqueLock lock(dedicated.mutex);
+				dedicated.condition.wait(lock, [&]() { return !dedicated.has_tick_pending; });
+			}
+
+			index = entries[index].subtree_end;
+		}
+	}
+
+	void TickPlan::tick_root(const TickInfo& root_tick_info)
+	{
+		ROBOTICK_ASSERT_MSG(is_compiled(), "TickPlan::tick_root() called before compile()");
+
+		// (the same in either mode - a root skipped in Hyperperiod mode doesn't move on to the next slot either)
+		TickPlanEntry& root = entries[0];
+		if (root.is_watchdog_skipping.is_set())
+			return;
+
+		if (!is_entry_enabled(0) || !is_entry_runnable(0))
+		{
+			root.workload_stats->skipped_tick_count++;
+			mark_entry_written(root, false);
+			return;
+		}
+
+		dispatch(root, 0, root_tick_info);
+	}
+
+	void TickPlan::tick_hyperperiod_children(uint32_t parent_index, const TickInfo& parent_tick_info)
+	{
+		// each root tick moves on to the next slot, from which every container within it then ticks its children:
+		if (parent_index == 0)
+		{
+			hyperperiod_slot_ticking = hyperperiod_slot_cursor;
+			hyperperiod_slot_cursor = (hyperperiod_slot_ticking + 1 < hyperperiod_slot_count) ? hyperperiod_slot_ticking + 1 : 0;
+		}
+
+		// everything listed in the slot is due - no rate counters to step. The slot lists its entries in pre-order, so this
+		// parent's descendants in it are those from its own index up to its subtree_end:
+		const uint32_t* slot_end = hyperperiod_slot_entries.data() + hyperperiod_slot_offsets[hyperperiod_slot_ticking + 1];
+		const uint32_t* cursor =
+			find_first_at_least(hyperperiod_slot_entries.data() + hyperperiod_slot_offsets[hyperperiod_slot_ticking], slot_end, parent_index + 1);
+
+		const uint32_t subtree_end = entries[parent_index].subtree_end;
+		while (cursor < slot_end && *cursor < subtree_end)
+		{
+			const uint32_t index = *cursor;
+			if (prepare_due_child(index, parent_tick_info))
+				run_child(index);
+
+			// on to its next sibling in the slot - its own descendants were ticked by it, or skipped along with it:
+			cursor = find_first_at_least(cursor + 1, slot_end, entries[index].subtree_end);
+		}
+	}
+
+	void TickPlan::tick_children(uint32_t parent_index, const TickInfo& parent_tick_info)
+	{
+		const uint32_t subtree_end = entries[parent_index].subtree_end;
+
+		// children are the entries directly following their parent; skipping each child's subtree lands on its next sibling
+		bool has_launched_dedicated = false;
+		uint32_t index = parent_index + 1;
+		while (index < subtree_end)
+		{
+			if (prepare_child(index, parent_tick_info))
+				has_launched_dedicated |= launch_child(index);
+
+			index = entries[index].subtree_end;
+		}
+
+		// subtrees on dedicated threads ran alongside their siblings, but still finish within this tick:
+		if (has_launched_dedicated)
+			wait_for_dedicated_children(parent_index);
+	}
+
+	void TickPlan::tick_children_parallel(uint32_t parent_index, const TickInfo& parent_tick_info)
+	{
+		if (worker_pool == nullptr || !worker_pool->is_running())
+		{
+			tick_children(parent_index, parent_tick_info);
+			return;
+		}
+
+		const uint32_t subtree_end = entries[parent_index].subtree_end;
+
+		// apply every due child's inputs before any of them runs, so siblings never observe each other mid-tick:
+		WorkerTask** batch = child_task_batch.data() + entries[parent_index].child_batch_begin;
+		size_t batch_size = 0;
+		bool has_launched_dedicated = false;
+
+		uint32_t index = parent_index + 1;
+		while (index < subtree_end)
+		{
+			if (prepare_child(index, parent_tick_info))
+			{
+				if (entries[index].dedicated_thread_index != TickPlanEntry::INVALID_INDEX)
+					has_launched_dedicated |= launch_child(index);
+				else
+					batch[batch_size++] = &child_tasks[index];
+			}
+
+			index = entries[index].subtree_end;
+		}
+
+		// returns once every child has finished - the end-of-tick barrier for this group
+		worker_pool->run_and_wait(batch, batch_size);
+
+		if (has_launched_dedicated)
+			wait_for_dedicated_children(parent_index);
+	}
+
+	void TickPlan::tick_children_dataflow(uint32_t parent_index, const TickInfo& parent_tick_info)
+	{
+		const TickPlanEntry& parent = entries[parent_index];
+		const bool use_worker_pool = worker_pool != nullptr && worker_pool->is_running();
+
+		WorkerTask** batch = child_task_batch.data() + parent.child_batch_begin;
+
+		for (uint32_t level_index = 0; level_index < parent.dataflow_levels_count; ++level_index)
+		{
+			const TickPlanDataflowLevel& level = dataflow_levels[parent.dataflow_levels_begin + level_index];
+
+			// every producer for this level has finished, so each consumer's connections can be copied now:
+			size_t batch_size = 0;
+			bool has_launched_dedicated = false;
+			for (uint32_t i = 0; i < level.count; ++i)
+			{
+				const uint32_t index = dataflow_level_entries[level.begin + i];
+				if (!prepare_child(index, parent_tick_info))
+					continue;
+
+				if (entries[index].dedicated_thread_index != TickPlanEntry::INVALID_INDEX)
+					has_launched_dedicated |= launch_child(index);
+				else
+					batch[batch_size++] = &child_tasks[index];
+			}
+
+			if (use_worker_pool && batch_size > 1)
+			{
+				worker_pool->run_and_wait(batch, batch_size);
+			}
+			else
+			{
+				for (size_t i = 0; i < batch_size; ++i)
+					run_child(batch[i]->index);
+			}
+
+			// the next level may consume this one's outputs:
+			if (has_launched_dedicated)
+				wait_for_dedicated_children(parent_index);
+		}
+	}
+
+	bool TickPlan::prepare_child(uint32_t index, const TickInfo& parent_tick_info)
+	{
+		TickPlanEntry& entry = entries[index];
+
+		if (entry.ticks_until_due > 0)
+		{
+			entry.ticks_until_due--;
+			return false;
+		}
+		entry.ticks_until_due = entry.tick_rate_divisor - 1;
+
+		return prepare_due_child(index, parent_tick_info);
+	}
+
+	bool TickPlan::prepare_due_child(uint32_t index, const TickInfo& parent_tick_info)
+	{
+		TickPlanEntry& entry = entries[index];
+
+		if (entry.is_watchdog_skipping.is_set())
+			return false;
+
+		bool has_event = entry.has_pending_event;
+		copy_connections(entry, has_event);
+
+		if ((entry.is_event_driven || entry.is_awaiting_io) && !has_event)
+			return false; // idle - its TickInfo is left as of its last tick, so the next delta spans the whole gap
+
+		// skipped if disabled or idle (its subtree along with it, never having been reached):
+		if (!is_entry_enabled(index) || !is_entry_runnable(index))
+		{
+			// (any event - including inputs just copied in - waits for the tick that consumes it)
+			entry.has_pending_event = has_event;
+			entry.workload_stats->skipped_tick_count++;
+			mark_entry_written(entry, false);
+			return false;
+		}
+
+		entry.has_pending_event = false;
+
+		TickInfo& tick_info = entry.tick_info;
+		const bool is_first_tick = (tick_info.tick_count == 0);
+		const uint64_t delta_ns = is_first_tick ? entry.tick_budget_ns : (parent_tick_info.time_now_ns - tick_info.time_now_ns);
+
+		constexpr float s_1_nanosecond_sec = 1e-9F;
+
+		tick_info.tick_count += 1;
+		tick_info.time_now_ns = parent_tick_info.time_now_ns;
+		tick_info.time_now = parent_tick_info.time_now;
+		tick_info.delta_time = delta_ns * s_1_nanosecond_sec;
+		entry.last_delta_ns = detail::clamp_to_uint32(delta_ns);
+
+		return true;
+	}
+
+	bool TickPlan::is_entry_runnable(uint32_t index) const
+	{
+		const TickPlanEntry& entry = entries[index];
+		if (entry.has_work_fn == nullptr)
+			return true;
+
+		if (entry.instance_count == 1)
+			return entry.has_work_fn(entry.instance_ptr);
+
+		// an instanced entry ticks as one, so runs if any element has work:
+		bool has_work = false;
+		entry.instance_info->for_each_element(static_cast<uint8_t*>(entry.instance_ptr),
+			[&](uint8_t* element_ptr)
+			{
+				has_work = has_work || entry.has_work_fn(element_ptr);
+			});
+		return has_work;
+	}
+
+	void TickPlan::run_child(uint32_t index)
+	{
+		TickPlanEntry& entry = entries[index];
+
+		const auto tick_start = Clock::now();
+
+		dispatch(entry, index, entry.tick_info);
+
+		const uint32_t duration_ns = detail::clamp_to_uint32(Clock::to_nanoseconds(Clock::now() - tick_start).count());
+		entry.workload_stats->record_tick_sample(duration_ns, entry.last_delta_ns, entry.tick_budget_ns);
+		entry.workload_stats->tick_count++;
+	}
+
+	void TickPlan::run_child_task(void* context, uint32_t index)
+	{
+		static_cast<TickPlan*>(context)->run_child(index);
+	}
+
+	void TickPlan::dispatch(TickPlanEntry& entry, uint32_t index, const TickInfo& tick_info)
+	{
+		const bool is_watched = entry.watchdog_budget_ns > 0;
+		if (is_watched)
+		{
+			entry.watchdog_tick_thread.store(Thread::get_current_thread_id(), std_approved::memory_order_relaxed);
+			entry.watchdog_tick_start_ns.store(
+				static_cast<uint64_t>(Clock::to_nanoseconds(Clock::now().time_since_epoch()).count()), std_approved::memory_order_release);
+		}
+
+		if (entry.tick_batch_fn)
+		{
+			entry.tick_batch_fn(entry.instance_ptr, entry.instance_count, tick_info);
+		}
+		else if (entry.async_tick_fn && entry.instance_count == 1)
+		{
+			entry.is_awaiting_io = (entry.async_tick_fn(entry.instance_ptr, tick_info) == AsyncTickStatus::AwaitingIo);
+		}
+		else if (entry.async_tick_fn)
+		{
+			// instanced and async - skipped only once every element awaits I/O (an awaiting element called meanwhile just re-checks its watch)
+			bool is_every_element_awaiting = true;
+			entry.instance_info->for_each_element(static_cast<uint8_t*>(entry.instance_ptr),
+				[&](uint8_t* element_ptr)
+				{
+					if (entry.async_tick_fn(element_ptr, tick_info) != AsyncTickStatus::AwaitingIo)
+						is_every_element_awaiting = false;
+				});
+			entry.is_awaiting_io = is_every_element_awaiting;
+		}
+		else if (entry.instance_count > 1)
+		{
+			// instanced, without a tick_batch of its own - still one dispatch, with the elements ticked back to back
+			entry.instance_info->for_each_element(
+				static_cast<uint8_t*>(entry.instance_ptr), [&](uint8_t* element_ptr) { entry.tick_fn(element_ptr, tick_info); });
+		}
+		else if (entry.tick_fn)
+		{
+			entry.tick_fn(entry.instance_ptr, tick_info);
+		}
+		else if (hyperperiod_slot_count > 0 && entry.hyperperiod_divisor != 0)
+		{
+			tick_hyperperiod_children(index, tick_info);
+		}
+		else if (entry.dataflow_levels_count > 0)
+		{
+			tick_children_dataflow(index, tick_info);
+		}
+		else
+		{
+			tick_children(index, tick_info);
+		}
+
+		if (is_watched)
+			entry.watchdog_tick_start_ns.store(0, std_approved::memory_order_release);
+
+		mark_entry_written(entry, true);
+	}
+
+	void TickPlan::copy_connections(const TickPlanEntry& entry, bool& has_event)
+	{
+		// only inputs that actually changed count as an event (or need marking dirty) - otherwise a plain copy is cheaper:
+		const bool is_change_needed = entry.is_event_driven || dirty_regions != nullptr;
+		for (uint32_t i = 0; i < entry.connections_count; ++i)
+		{
+			const DataConnectionInfo* connection = connections[entry.connections_begin + i];
+			if (!is_change_needed)
+			{
+				connection->do_data_copy();
+			}
+			else if (connection->do_data_copy_if_changed())
+			{
+				has_event = has_event || entry.is_event_driven;
+				if (dirty_regions != nullptr)
+					dirty_regions->mark_dirty(connection->dest_ptr, connection->size);
+			}
+		}
+	}
+
+	void TickPlan::mark_entry_written(const TickPlanEntry& entry, bool is_ticked)
+	{
+		if (dirty_regions == nullptr)
+			return;
+
+		// stats change even on a skipped tick; outputs (and their blackboard storage) only when it actually ticked:
+		dirty_regions->mark_dirty(entry.workload_stats, sizeof(WorkloadInstanceStats));
+		if (!is_ticked)
+			return;
+
+		if (entry.outputs_ptr != nullptr)
+			dirty_regions->mark_dirty(entry.outputs_ptr, entry.outputs_size);
+		dirty_regions->mark_dirty_range(entry.instance_info->outputs_storage_offset, entry.instance_info->outputs_storage_size);
+
+		// a workload with a tick of its own ticks its children itself, out of the plan's sight - so any of them may have written
+		// anything, and the whole of each is marked (with a self-ticking root, that is the whole tree):
+		const uint32_t index = static_cast<uint32_t>(&entry - entries.data());
+		if (!entry.has_tick() || entry.subtree_end <= index + 1)
+			return;
+
+		for (uint32_t descendant_index = index + 1; descendant_index < entry.subtree_end; ++descendant_index)
+		{
+			const TickPlanEntry& descendant = entries[descendant_index];
+			dirty_regions->mark_dirty(descendant.workload_stats, sizeof(WorkloadInstanceStats));
+			dirty_regions->mark_dirty_range(descendant.instance_info->offset_in_workloads_buffer, descendant.instance_info->get_size());
+			dirty_regions->mark_dirty_range(
+				descendant.instance_info->outputs_storage_offset, descendant.instance_info->outputs_storage_size);
+		}
+	}
+
+	uint32_t TickPlan::find_entry_index(const WorkloadInstanceInfo& instance) const
+	{
+		if (instances_begin == nullptr || &instance < instances_begin)
+			return TickPlanEntry::INVALID_INDEX;
+
+		const size_t instance_index = static_cast<size_t>(&instance - instances_begin);
+		if (instance_index >= entry_index_by_instance.size())
+			return TickPlanEntry::INVALID_INDEX;
+
+		return entry_index_by_instance[instance_index];
+	}
+
+} // namespace robotick
@@ -0,0 +1,153 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/Watchdog.h"
+
+#include "robotick/framework/WorkloadInstanceInfo.h"
+#include "robotick/framework/model/WorkloadSeed.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "robotick/framework/system/System.h"
+#include "robotick/framework/time/Clock.h"
+
+namespace robotick
+{
+	namespace
+	{
+		const char* get_action_name(WatchdogAction action)
+		{
+			switch (action)
+			{
+			case WatchdogAction::Log:
+				return "logging it";
+			case WatchdogAction::SkipTicks:
+				return "skipping its ticks from now on";
+			case WatchdogAction::Stop:
+				return "stopping the engine";
+			}
+			return "unknown";
+		}
+	} // namespace
+
+	void Watchdog::start(TickPlan& in_tick_plan)
+	{
+		stop();
+
+		tick_plan = &in_tick_plan;
+		stop_requested.clear();
+
+		// the watched entries are fixed once the plan is compiled, so only gather them once:
+		if (watched_entry_indices.size() == 0)
+		{
+			const HeapVector<TickPlanEntry>& entries = tick_plan->get_entries();
+
+			uint32_t watched_count = 0;
+			for (const TickPlanEntry& entry : entries)
+				watched_count += (entry.watchdog_budget_ns > 0) ? 1 : 0;
+
+			if (watched_count == 0)
+				return;
+
+			watched_entry_indices.initialize(watched_count);
+			tripped_tick_start_ns.initialize(watched_count);
+
+			uint32_t watched_index = 0;
+			for (uint32_t index = 0; index < entries.size(); ++index)
+			{
+				if (entries[index].watchdog_budget_ns > 0)
+					watched_entry_indices[watched_index++] = index;
+			}
+		}
+
+		for (uint64_t& tripped_start_ns : tripped_tick_start_ns)
+			tripped_start_ns = 0;
+
+		is_stopping = false;
+		is_thread_running = true;
+		thread = Thread(&Watchdog::thread_entry, this, "robotick-watchdog");
+	}
+
+	void Watchdog::stop()
+	{
+		if (!is_thread_running)
+			return;
+
+		{
+			LockGuard lock(mutex);
+			is_stopping = true;
+		}
+		condition.notify_all();
+
+		if (thread.is_joining_supported() && thread.is_joinable())
+			thread.join();
+
+		is_thread_running = false;
+	}
+
+	void Watchdog::thread_entry(void* arg)
+	{
+		Watchdog& watchdog = *static_cast<Watchdog*>(arg);
+
+		UniqueLock lock(watchdog.mutex);
+		while (!watchdog.condition.wait_for(
+			lock, std_approved::chrono::milliseconds(DEFAULT_WATCHDOG_POLL_INTERVAL_MS), [&]() { return watchdog.is_stopping; }))
+		{
+			watchdog.check_locked(static_cast<uint64_t>(Clock::to_nanoseconds(Clock::now().time_since_epoch()).count()));
+		}
+	}
+
+	void Watchdog::check(uint64_t now_ns)
+	{
+		LockGuard lock(mutex);
+		check_locked(now_ns);
+	}
+
+	void Watchdog::check_locked(uint64_t now_ns)
+	{
+		if (tick_plan == nullptr)
+			return;
+
+		const HeapVector<TickPlanEntry>& entries = tick_plan->get_entries();
+
+		for (size_t i = 0; i < watched_entry_indices.size(); ++i)
+		{
+			const uint32_t entry_index = watched_entry_indices[i];
+			const TickPlanEntry& entry = entries[entry_index];
+
+			const uint64_t tick_start_ns = entry.watchdog_tick_start_ns.load(std_approved::memory_order_acquire);
+			if (tick_start_ns == 0 || tick_start_ns == tripped_tick_start_ns[i] || now_ns < tick_start_ns)
+				continue;
+
+			const uint64_t tick_elapsed_ns = now_ns - tick_start_ns;
+			if (tick_elapsed_ns <= entry.watchdog_budget_ns)
+				continue;
+
+			tripped_tick_start_ns[i] = tick_start_ns;
+			trip(entry_index, tick_elapsed_ns);
+		}
+	}
+
+	void Watchdog::trip(uint32_t entry_index, uint64_t tick_elapsed_ns)
+	{
+		TickPlanEntry& entry = tick_plan->get_entries()[entry_index];
+
+		// only this thread writes it, so telemetry sees a plain (if racy) counter like the rest of the stats:
+		entry.workload_stats->watchdog_trip_count++;
+
+		ROBOTICK_WARNING("Watchdog: workload '%s' has been ticking for %.2f ms (budget %.2f ms) - %s",
+			entry.instance_info->seed->unique_name.c_str(),
+			tick_elapsed_ns * 1e-6,
+			entry.watchdog_budget_ns * 1e-6,
+			get_action_name(entry.watchdog_action));
+
+		void* frames[32];
+		const size_t frame_count = System::capture_thread_stack(entry.watchdog_tick_thread.load(), frames, 32);
+		if (frame_count > 0)
+			System::log_stack_frames(frames, frame_count);
+
+		if (entry.watchdog_action == WatchdogAction::SkipTicks)
+			entry.is_watchdog_skipping.set();
+		else if (entry.watchdog_action == WatchdogAction::Stop)
+			stop_requested.set();
+	}
+
+} // namespace robotick
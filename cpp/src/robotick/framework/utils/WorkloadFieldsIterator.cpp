@@ -31,9 +31,23 @@ namespace robotick
 		const WorkloadDescriptor* workload_desc = workload_type->get_workload_desc();
 		ROBOTICK_ASSERT(workload_desc != nullptr);
 
-		for_each_field_in_struct(instance, workload_desc->config_desc, workload_desc->config_offset, workloads_buffer, callback);
-		for_each_field_in_struct(instance, workload_desc->inputs_desc, workload_desc->inputs_offset, workloads_buffer, callback);
-		for_each_field_in_struct(instance, workload_desc->outputs_desc, workload_desc->outputs_offset, workloads_buffer, callback);
+		for (uint32_t element_index = 0; element_index < instance.instance_count; ++element_index)
+		{
+			const size_t element_offset = element_index * instance.get_element_size();
+			const auto element_callback = [&](const WorkloadFieldView& view)
+			{
+				WorkloadFieldView element_view = view;
+				element_view.element_index = element_index;
+				callback(element_view);
+			};
+
+			for_each_field_in_struct(
+				instance, workload_desc->config_desc, element_offset + workload_desc->config_offset, workloads_buffer, element_callback);
+			for_each_field_in_struct(
+				instance, workload_desc->inputs_desc, element_offset + workload_desc->inputs_offset, workloads_buffer, element_callback);
+			for_each_field_in_struct(
+				instance, workload_desc->outputs_desc, element_offset + workload_desc->outputs_offset, workloads_buffer, element_callback);
+		}
 	}
 
 	void WorkloadFieldsIterator::for_each_field_in_struct(const WorkloadInstanceInfo& instance,
@@ -89,7 +103,7 @@ namespace robotick
 				continue;
 			}
 
-			WorkloadFieldView view{parent_field.workload_info, parent_type_desc, &field_desc, nullptr, base_ptr};
+			WorkloadFieldView view{parent_field.workload_info, parent_type_desc, &field_desc, nullptr, base_ptr, parent_field.element_index};
 			callback(view);
 		}
 	}
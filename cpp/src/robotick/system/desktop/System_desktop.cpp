@@ -7,8 +7,65 @@
 
 #include "robotick/framework/system/System.h"
 
+#include "robotick/api_base.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Sync.h"
+#include "robotick/framework/concurrency/Thread.h"
+
+#include <cerrno>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <execinfo.h>
+#include <fcntl.h>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace robotick
 {
+#if defined(__linux__)
+	namespace
+	{
+		// One stack sample at a time. The buffer is static (rather than the caller's) so a handler that runs after we've given
+		// up waiting on it can't write into a dead stack frame. Each request's signal carries its generation, which the handler
+		// must claim before writing - so a signal arriving after its request timed out can't fill in a later request's sample.
+		struct StackSample
+		{
+			static constexpr int max_frames = 64;
+
+			Mutex mutex;
+			void* frames[max_frames] = {};
+			AtomicValue<int> frame_count{0};
+			AtomicValue<int> requested_generation{0}; // the request awaiting its handler (0 = none)
+			AtomicFlag is_done;
+			int last_generation = 0; // (guarded by mutex)
+			bool is_handler_installed = false;
+		};
+
+		StackSample g_stack_sample;
+
+		void stack_sample_handler(int, siginfo_t* info, void*)
+		{
+			int generation = info->si_value.sival_int;
+			if (generation == 0 || !g_stack_sample.requested_generation.compare_exchange_strong(generation, 0))
+				return; // (a stale signal, or one we didn't send)
+
+			g_stack_sample.frame_count.store(::backtrace(g_stack_sample.frames, StackSample::max_frames));
+			g_stack_sample.is_done.set();
+		}
+
+		int get_stack_sample_signal()
+		{
+			return SIGRTMIN + 1; // above the real-time signals glibc reserves for itself
+		}
+	} // namespace
+#endif
 
 	void System::initialize()
 	{
@@ -16,6 +73,288 @@ namespace robotick
 		// Could add locale setup, stdout flush tweaks, etc later
 	}
 
+	bool System::bind_memory_to_numa_node(void* ptr, size_t size, int numa_node)
+	{
+#if defined(__linux__)
+		constexpr int max_nodes = static_cast<int>(sizeof(unsigned long) * 8);
+		if (ptr == nullptr || size == 0 || numa_node < 0 || numa_node >= max_nodes)
+			return false;
+
+		const uintptr_t page_size = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+		const uintptr_t begin = reinterpret_cast<uintptr_t>(ptr) & ~(page_size - 1);
+		const uintptr_t end = (reinterpret_cast<uintptr_t>(ptr) + size + page_size - 1) & ~(page_size - 1);
+		const unsigned long node_mask = 1ul << numa_node;
+
+		// raw syscall so we don't depend on libnuma; MPOL_PREFERRED (rather than MPOL_BIND) falls back to other nodes when full
+		return ::syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED, &node_mask, max_nodes + 1, MPOL_MF_MOVE) == 0;
+#else
+		(void)ptr;
+		(void)size;
+		(void)numa_node;
+		return false;
+#endif
+	}
+
+	void* System::map_locked_memory(size_t size, size_t& out_mapped_size, bool& out_is_locked)
+	{
+		out_mapped_size = 0;
+		out_is_locked = false;
+
+#if defined(__linux__)
+		if (size == 0)
+			return nullptr;
+
+		constexpr uintptr_t huge_page_size = 2 * 1024 * 1024; // the default huge page on x86-64 and (4K-paged) arm64
+		const uintptr_t page_size = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+		auto round_up = [](uintptr_t value, uintptr_t multiple) { return (value + multiple - 1) & ~(multiple - 1); };
+
+		// explicit huge pages first - only there if reserved (vm.nr_hugepages) - which MAP_POPULATE pre-faults for us:
+		size_t mapped_size = round_up(size, huge_page_size);
+		void* ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+
+		if (ptr == MAP_FAILED)
+		{
+			// otherwise ordinary pages - aligned to a huge page if big enough, so transparent huge pages can back them:
+			const bool is_huge_page_candidate = size >= huge_page_size;
+			mapped_size = round_up(size, is_huge_page_candidate ? huge_page_size : page_size);
+			const size_t reserved_size = mapped_size + (is_huge_page_candidate ? huge_page_size : 0);
+
+			void* reserved = ::mmap(nullptr, reserved_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (reserved == MAP_FAILED)
+				return nullptr;
+
+			const uintptr_t reserved_begin = reinterpret_cast<uintptr_t>(reserved);
+			const uintptr_t begin = is_huge_page_candidate ? round_up(reserved_begin, huge_page_size) : reserved_begin;
+			const uintptr_t end = begin + mapped_size;
+
+			// trim the alignment slack from either end:
+			if (begin > reserved_begin)
+				::munmap(reserved, begin - reserved_begin);
+			if (reserved_begin + reserved_size > end)
+				::munmap(reinterpret_cast<void*>(end), reserved_begin + reserved_size - end);
+
+			ptr = reinterpret_cast<void*>(begin);
+			if (is_huge_page_candidate)
+				::madvise(ptr, mapped_size, MADV_HUGEPAGE); // advisory - ignored where transparent huge pages are disabled
+
+			// pre-fault by writing to every page (reads would only map the shared zero page):
+			volatile uint8_t* bytes = static_cast<volatile uint8_t*>(ptr);
+			for (uintptr_t offset = 0; offset < mapped_size; offset += page_size)
+				bytes[offset] = 0;
+		}
+
+		// needs RLIMIT_MEMLOCK headroom (or CAP_IPC_LOCK) - the pages are resident either way, just not pinned there:
+		out_is_locked = ::mlock(ptr, mapped_size) == 0;
+		out_mapped_size = mapped_size;
+		return ptr;
+#else
+		(void)size;
+		return nullptr;
+#endif
+	}
+
+	void System::unmap_locked_memory(void* ptr, size_t mapped_size)
+	{
+#if defined(__linux__)
+		if (ptr != nullptr && mapped_size > 0)
+			::munmap(ptr, mapped_size); // also unlocks
+#else
+		(void)ptr;
+		(void)mapped_size;
+#endif
+	}
+
+	void* System::create_shared_memory(const char* name, size_t size, size_t& out_mapped_size, bool& out_already_exists)
+	{
+		out_mapped_size = 0;
+		out_already_exists = false;
+
+#if defined(__linux__)
+		if (name == nullptr || size == 0)
+			return nullptr;
+
+		// never replaces an existing segment - it may belong to a running engine, which only the caller can rule out:
+		const int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+		if (fd < 0)
+		{
+			out_already_exists = (errno == EEXIST);
+			return nullptr;
+		}
+
+		const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+		const size_t mapped_size = (size + page_size - 1) & ~(page_size - 1);
+
+		void* ptr = MAP_FAILED;
+		if (::ftruncate(fd, static_cast<off_t>(mapped_size)) == 0) // (zero-filled)
+			ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd); // the mapping keeps the segment open
+
+		if (ptr == MAP_FAILED)
+		{
+			::shm_unlink(name);
+			return nullptr;
+		}
+
+		out_mapped_size = mapped_size;
+		return ptr;
+#else
+		(void)name;
+		(void)size;
+		return nullptr;
+#endif
+	}
+
+	const void* System::open_shared_memory(const char* name, size_t& out_mapped_size)
+	{
+		out_mapped_size = 0;
+
+#if defined(__linux__)
+		if (name == nullptr)
+			return nullptr;
+
+		const int fd = ::shm_open(name, O_RDONLY, 0);
+		if (fd < 0)
+			return nullptr;
+
+		struct stat segment_stat = {};
+		void* ptr = MAP_FAILED;
+		if (::fstat(fd, &segment_stat) == 0 && segment_stat.st_size > 0)
+			ptr = ::mmap(nullptr, static_cast<size_t>(segment_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+
+		if (ptr == MAP_FAILED)
+			return nullptr;
+
+		out_mapped_size = static_cast<size_t>(segment_stat.st_size);
+		return ptr;
+#else
+		(void)name;
+		return nullptr;
+#endif
+	}
+
+	void System::unmap_shared_memory(const void* ptr, size_t mapped_size)
+	{
+#if defined(__linux__)
+		if (ptr != nullptr && mapped_size > 0)
+			::munmap(const_cast<void*>(ptr), mapped_size);
+#else
+		(void)ptr;
+		(void)mapped_size;
+#endif
+	}
+
+	void System::unlink_shared_memory(const char* name)
+	{
+#if defined(__linux__)
+		if (name != nullptr)
+			::shm_unlink(name);
+#else
+		(void)name;
+#endif
+	}
+
+	int64_t System::get_process_id()
+	{
+#if defined(__linux__)
+		return static_cast<int64_t>(::getpid());
+#else
+		return 0;
+#endif
+	}
+
+	bool System::is_process_alive(int64_t process_id)
+	{
+#if defined(__linux__)
+		if (process_id <= 0)
+			return true; // (not a process we can ask about)
+
+		// (EPERM: it exists, but belongs to another user)
+		return ::kill(static_cast<pid_t>(process_id), 0) == 0 || errno != ESRCH;
+#else
+		(void)process_id;
+		return true;
+#endif
+	}
+
+	size_t System::capture_thread_stack(uintptr_t thread_id, void** out_frames, size_t max_frames)
+	{
+#if defined(__linux__)
+		if (thread_id == 0 || out_frames == nullptr || max_frames == 0)
+			return 0;
+
+		LockGuard lock(g_stack_sample.mutex);
+
+		if (!g_stack_sample.is_handler_installed)
+		{
+			// backtrace() loads libgcc on first use - get that (and its allocation) done here, not inside the signal handler:
+			void* warm_up_frame = nullptr;
+			::backtrace(&warm_up_frame, 1);
+
+			struct sigaction action = {};
+			action.sa_sigaction = &stack_sample_handler;
+			action.sa_flags = SA_RESTART | SA_SIGINFO;
+			sigemptyset(&action.sa_mask);
+			if (::sigaction(get_stack_sample_signal(), &action, nullptr) != 0)
+				return 0;
+
+			g_stack_sample.is_handler_installed = true;
+		}
+
+		int generation = (g_stack_sample.last_generation < INT32_MAX) ? g_stack_sample.last_generation + 1 : 1;
+		g_stack_sample.last_generation = generation;
+
+		g_stack_sample.frame_count.store(0);
+		g_stack_sample.is_done.clear();
+		g_stack_sample.requested_generation.store(generation);
+
+		union sigval value = {};
+		value.sival_int = generation;
+		if (::pthread_sigqueue(reinterpret_cast<pthread_t>(thread_id), get_stack_sample_signal(), value) != 0)
+		{
+			g_stack_sample.requested_generation.store(0);
+			return 0;
+		}
+
+		// a thread that can't take the signal within ~100ms (e.g. stuck in an uninterruptible syscall) yields no sample:
+		for (int attempt = 0; attempt < 100 && !g_stack_sample.is_done.is_set(); ++attempt)
+			Thread::sleep_ms(1);
+
+		// withdraw the request - unless its handler has already claimed it, in which case let it finish writing the sample:
+		if (!g_stack_sample.requested_generation.compare_exchange_strong(generation, 0))
+		{
+			while (!g_stack_sample.is_done.is_set())
+				Thread::sleep_ms(1);
+		}
+
+		if (!g_stack_sample.is_done.is_set())
+			return 0;
+
+		size_t frame_count = static_cast<size_t>(g_stack_sample.frame_count.load());
+		frame_count = (frame_count < max_frames) ? frame_count : max_frames;
+		for (size_t i = 0; i < frame_count; ++i)
+			out_frames[i] = g_stack_sample.frames[i];
+
+		return frame_count;
+#else
+		(void)thread_id;
+		(void)out_frames;
+		(void)max_frames;
+		return 0;
+#endif
+	}
+
+	void System::log_stack_frames(void* const* frames, size_t frame_count)
+	{
+#if defined(__linux__)
+		// written straight to stderr, which needs no allocation (unlike backtrace_symbols())
+		::backtrace_symbols_fd(frames, static_cast<int>(frame_count), STDERR_FILENO);
+#else
+		for (size_t i = 0; i < frame_count; ++i)
+			ROBOTICK_WARNING("  #%zu %p", i, frames[i]);
+#endif
+	}
+
 } // namespace robotick
 
 #endif // ROBOTICK_PLATFORM_DESKTOP
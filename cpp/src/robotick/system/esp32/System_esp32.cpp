@@ -16,6 +16,62 @@ namespace robotick
 		// by higher-level helpers (e.g., robotick::boards::m5::ensure_initialized()).
 	}
 
+	bool System::bind_memory_to_numa_node(void*, size_t, int)
+	{
+		return false; // single memory node
+	}
+
+	void* System::map_locked_memory(size_t, size_t& out_mapped_size, bool& out_is_locked)
+	{
+		out_mapped_size = 0;
+		out_is_locked = false;
+		return nullptr; // no paging or swap to avoid - the heap is already resident
+	}
+
+	void System::unmap_locked_memory(void*, size_t)
+	{
+	}
+
+	void* System::create_shared_memory(const char*, size_t, size_t& out_mapped_size, bool& out_already_exists)
+	{
+		out_mapped_size = 0;
+		out_already_exists = false;
+		return nullptr; // a single address space - there are no other processes to share with
+	}
+
+	const void* System::open_shared_memory(const char*, size_t& out_mapped_size)
+	{
+		out_mapped_size = 0;
+		return nullptr;
+	}
+
+	void System::unmap_shared_memory(const void*, size_t)
+	{
+	}
+
+	void System::unlink_shared_memory(const char*)
+	{
+	}
+
+	int64_t System::get_process_id()
+	{
+		return 1; // (the one process)
+	}
+
+	bool System::is_process_alive(int64_t)
+	{
+		return true;
+	}
+
+	size_t System::capture_thread_stack(uintptr_t, void**, size_t)
+	{
+		return 0; // FreeRTOS has no way to sample another task's stack - the watchdog still reports which workload hung
+	}
+
+	void System::log_stack_frames(void* const*, size_t)
+	{
+	}
+
 } // namespace robotick
 
 #endif // ROBOTICK_PLATFORM_ESP32S3
@@ -6,14 +6,20 @@
 #include "robotick/framework/WorkloadInstanceInfo.h"
 #include "robotick/framework/concurrency/Atomic.h"
 #include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/data/Blackboard.h"
 #include "robotick/framework/data/DataConnection.h"
 #include "robotick/framework/data/TelemetryServer.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
+#include "robotick/framework/time/Clock.h"
+#include "utils/TelemetryTestUtils.h"
 
 #include <algorithm>
 #include <arpa/inet.h>
 #include <atomic>
 #include <catch2/catch_all.hpp>
 #include <chrono>
+#include <cstring>
 #include <netinet/in.h>
 #include <nlohmann/json.hpp>
 #include <sys/socket.h>
@@ -87,6 +93,62 @@ namespace robotick::test
 
 	ROBOTICK_REGISTER_WORKLOAD(OverrunWorkload)
 
+	// overruns its first tick by several periods (a sleep never returns early, so at least that many), then ticks promptly
+	struct OverrunOnceWorkload
+	{
+		static constexpr uint32_t overrun_ms = 35;
+
+		uint64_t tick_count = 0;
+
+		void tick(const TickInfo&)
+		{
+			tick_count++;
+			if (tick_count == 1)
+				Thread::sleep_ms(overrun_ms);
+		}
+	};
+
+	ROBOTICK_REGISTER_WORKLOAD(OverrunOnceWorkload)
+
+	// slow to load, and remembers which thread loaded it
+	struct SlowLoadWorkload
+	{
+		Thread::ThreadId load_thread{};
+		bool is_setup = false;
+
+		void load()
+		{
+			load_thread = Thread::get_current_thread_id();
+			Thread::sleep_ms(30);
+		}
+
+		void setup() { is_setup = true; }
+	};
+
+	ROBOTICK_REGISTER_WORKLOAD(SlowLoadWorkload)
+
+	// folds every TickInfo it sees into a checksum, so whole runs can be compared
+	struct TickTraceWorkload
+	{
+		uint64_t tick_count = 0;
+		uint64_t last_time_now_ns = 0;
+		float last_delta_time = 0.0f;
+		uint64_t checksum = 0;
+
+		void tick(const TickInfo& tick_info)
+		{
+			tick_count++;
+			last_time_now_ns = tick_info.time_now_ns;
+			last_delta_time = tick_info.delta_time;
+
+			uint32_t delta_bits = 0;
+			::memcpy(&delta_bits, &tick_info.delta_time, sizeof(delta_bits));
+			checksum = checksum * 1099511628211ull + tick_info.tick_count + tick_info.time_now_ns + delta_bits;
+		}
+	};
+
+	ROBOTICK_REGISTER_WORKLOAD(TickTraceWorkload)
+
 	namespace
 	{
 		// === DummyWorkload (with config/inputs/load) ===
@@ -170,52 +232,90 @@ namespace robotick::test
 		};
 		ROBOTICK_REGISTER_WORKLOAD(LayoutEnumWorkload, LayoutEnumConfig)
 
-	} // namespace
+		// === BigBlackboardWorkload ===
+		// declares its blackboard's fields in pre_load (as scripted workloads do) - bigger than any fixed reservation would allow
 
-	// === Utility helpers ===
+		struct BigBlackboardOutputs
+		{
+			Blackboard samples;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(BigBlackboardOutputs)
+		ROBOTICK_STRUCT_FIELD(BigBlackboardOutputs, Blackboard, samples)
+		ROBOTICK_REGISTER_STRUCT_END(BigBlackboardOutputs)
 
-	uint16_t find_free_port_for_test()
-	{
-		int sock = ::socket(AF_INET, SOCK_STREAM, 0);
-		if (sock < 0)
-			return 0;
+		struct BigBlackboardState
+		{
+			static constexpr size_t text_field_count = 640; // x 1 KB each
 
-		sockaddr_in addr{};
-		addr.sin_family = AF_INET;
-		addr.sin_addr.s_addr = htonl(INADDR_ANY);
-		addr.sin_port = 0;
+			HeapVector<FixedString32> field_names;
+			HeapVector<FieldDescriptor> fields;
+		};
 
-		if (::bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+		struct BigBlackboardWorkload
 		{
-			::close(sock);
-			return 0;
-		}
+			static constexpr bool is_relocatable = true; // (its State<> only points at the heap)
+
+			BigBlackboardOutputs outputs;
+			State<BigBlackboardState> state;
+
+			void pre_load()
+			{
+				state->field_names.initialize(BigBlackboardState::text_field_count);
+				state->fields.initialize(BigBlackboardState::text_field_count + 1);
+				state->fields[0] = FieldDescriptor{"count", GET_TYPE_ID(int)};
+				for (size_t i = 0; i < BigBlackboardState::text_field_count; ++i)
+				{
+					state->field_names[i].format("text_%zu", i);
+					state->fields[i + 1] = FieldDescriptor{state->field_names[i].c_str(), GET_TYPE_ID(FixedString1024)};
+				}
+				outputs.samples.initialize_fields(state->fields);
+			}
 
-		socklen_t addr_len = sizeof(addr);
-		if (::getsockname(sock, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0)
+			void tick(const TickInfo&) { outputs.samples.set<int>("count", outputs.samples.get<int>("count") + 1); }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(BigBlackboardWorkload, void, void, BigBlackboardOutputs)
+
+		// binds its blackboard to a member array, which moves (and would dangle) when the workloads buffer is relocated
+		struct InlineFieldsBlackboardWorkload
 		{
-			::close(sock);
-			return 0;
-		}
+			BigBlackboardOutputs outputs;
+			FieldDescriptor fields[1];
 
-		const uint16_t port = ntohs(addr.sin_port);
-		::close(sock);
-		// NOTE: this is still vulnerable to a TOCTOU race—the port is released before the Engine binds, so another
-		// process could grab it. We accept occasional flake on busy hosts, or keep extending the search loop if needed.
-		return port;
-	}
+			void pre_load()
+			{
+				fields[0] = FieldDescriptor{"count", GET_TYPE_ID(int)};
+				outputs.samples.initialize_fields(ArrayView<FieldDescriptor>(fields));
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(InlineFieldsBlackboardWorkload, void, void, BigBlackboardOutputs)
 
-	uint16_t choose_telemetry_port()
-	{
-		for (int attempt = 0; attempt < 3; ++attempt)
+		// remembers where it was constructed - so can't be moved byte-for-byte afterwards (and isn't trivially copyable)
+		struct SelfPointingWorkload
 		{
-			const uint16_t port = find_free_port_for_test();
-			if (port != 0)
-				return port;
-		}
-		ROBOTICK_FATAL_EXIT("Engine test: no free telemetry port found after 3 attempts");
-		return 0;
-	}
+			SelfPointingWorkload()
+				: self(this)
+			{
+			}
+
+			SelfPointingWorkload(const SelfPointingWorkload&)
+				: self(this)
+			{
+			}
+
+			const SelfPointingWorkload* self = nullptr;
+		};
+		ROBOTICK_REGISTER_WORKLOAD(SelfPointingWorkload)
+
+		// laid out last, so the workloads end (and blackboard storage begins) off any alignment boundary
+		struct OddSizedWorkload
+		{
+			char bytes[3] = {};
+		};
+		ROBOTICK_REGISTER_WORKLOAD(OddSizedWorkload)
+
+	} // namespace
+
+	// === Utility helpers ===
 
 	bool bind_to_port(uint16_t port)
 	{
@@ -491,6 +591,43 @@ namespace robotick::test
 			CHECK((*enum_it)["enum_is_flags"] == false);
 		}
 
+		SECTION("Telemetry layout describes every element of an instanced workload")
+		{
+			Model model;
+			model.set_telemetry_port(choose_telemetry_port());
+			static const WorkloadSeed workload_seed{
+				TypeId("LayoutEnumWorkload"), StringView("layout_enum_instanced"), WorkloadInstanceCount(2), 30.0f};
+			static const WorkloadSeed* const root_children[] = {&workload_seed};
+			static const WorkloadSeed root{TypeId("TestSequencedGroupWorkload"), StringView("layout_enum_group"), 30.0f, root_children};
+			static const WorkloadSeed* const workloads[] = {&workload_seed, &root};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			nlohmann::ordered_json layout = build_workloads_buffer_layout_json(engine, "test");
+
+			const WorkloadInstanceInfo* info = engine.find_instance_info("layout_enum_instanced");
+			REQUIRE(info != nullptr);
+
+			const nlohmann::ordered_json* element_jsons[2] = {};
+			for (const auto& workload_json : layout["workloads"])
+			{
+				CHECK(workload_json["name"] != "layout_enum_instanced");
+				if (workload_json["name"] == "layout_enum_instanced[0]")
+					element_jsons[0] = &workload_json;
+				if (workload_json["name"] == "layout_enum_instanced[1]")
+					element_jsons[1] = &workload_json;
+			}
+			REQUIRE(element_jsons[0] != nullptr);
+			REQUIRE(element_jsons[1] != nullptr);
+
+			CHECK((*element_jsons[0])["offset_within_container"] == info->offset_in_workloads_buffer);
+			CHECK((*element_jsons[1])["offset_within_container"] == info->offset_in_workloads_buffer + info->get_element_size());
+			CHECK((*element_jsons[0])["stats_offset_within_container"] == (*element_jsons[1])["stats_offset_within_container"]);
+		}
+
 		SECTION("start_fn executes on same thread as tick_fn")
 		{
 			Model model;
@@ -524,4 +661,455 @@ namespace robotick::test
 		}
 	}
 
+	TEST_CASE("Unit/Framework/Engine/OverrunPolicy")
+	{
+		static const WorkloadSeed workload_seed{TypeId("OverrunOnceWorkload"), StringView("overrun_once"), 100.0f};
+		static const WorkloadSeed* const workloads[] = {&workload_seed};
+
+		// steps a 100Hz root through its overrunning first tick, checking where each policy puts the next deadline - which
+		// depends only on how late the tick finished (never sooner than the overrun), not on how the machine is scheduling us
+		const auto interval = Clock::from_seconds(0.01f);
+		const auto overrun = Clock::from_seconds(OverrunOnceWorkload::overrun_ms * 0.001f);
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(workload_seed);
+
+		SECTION("CatchUp keeps the original schedule, so the missed ticks are due straight away")
+		{
+			model.set_overrun_policy(OverrunPolicy::CatchUp);
+			Engine engine;
+			engine.load(model);
+
+			const auto first_tick_time = engine.begin_stepped_run();
+			const auto next_tick_time = engine.step();
+			const auto step_end_time = Clock::now();
+			engine.end_stepped_run();
+
+			CHECK(next_tick_time == first_tick_time + interval);
+			CHECK(next_tick_time < step_end_time);
+			CHECK(engine.get_root_instance_info()->workload_stats->missed_deadline_count == 1);
+		}
+
+		SECTION("SkipAndRealign drops the missed ticks, resuming on the original phase")
+		{
+			model.set_overrun_policy(OverrunPolicy::SkipAndRealign);
+			Engine engine;
+			engine.load(model);
+
+			const auto first_tick_time = engine.begin_stepped_run();
+			const auto next_tick_time = engine.step();
+			engine.end_stepped_run();
+
+			const auto ticks_later = (next_tick_time - first_tick_time) / interval;
+			CHECK(next_tick_time == first_tick_time + interval * ticks_later);
+			CHECK(interval * ticks_later > overrun);
+			CHECK(engine.get_root_instance_info()->workload_stats->missed_deadline_count == 1);
+		}
+
+		SECTION("StretchPeriod measures the schedule afresh from the end of the overrun")
+		{
+			model.set_overrun_policy(OverrunPolicy::StretchPeriod);
+			Engine engine;
+			engine.load(model);
+
+			const auto first_tick_time = engine.begin_stepped_run();
+			const auto next_tick_time = engine.step();
+			const auto step_end_time = Clock::now();
+			engine.end_stepped_run();
+
+			CHECK(next_tick_time >= first_tick_time + overrun);
+			CHECK(next_tick_time <= step_end_time);
+			CHECK(engine.get_root_instance_info()->workload_stats->missed_deadline_count == 1);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/ParallelLoad")
+	{
+		static const WorkloadSeed slow_a{TypeId("SlowLoadWorkload"), StringView("slow_load_a"), 100.0f};
+		static const WorkloadSeed slow_b{TypeId("SlowLoadWorkload"), StringView("slow_load_b"), 100.0f};
+		static const WorkloadSeed slow_c{TypeId("SlowLoadWorkload"), StringView("slow_load_c"), 100.0f};
+		static const WorkloadSeed slow_d{TypeId("SlowLoadWorkload"), StringView("slow_load_d"), 100.0f};
+		static const WorkloadSeed* const workloads[] = {&slow_a, &slow_b, &slow_c, &slow_d};
+		static const char* const names[] = {"slow_load_a", "slow_load_b", "slow_load_c", "slow_load_d"};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(slow_a);
+
+		SECTION("Load phases are shared across the worker pool, with per-workload timings")
+		{
+			model.set_worker_thread_count(4);
+			model.set_parallel_load_enabled(true);
+
+			Engine engine;
+			engine.load(model);
+
+			int threads_seen = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				const auto* workload = engine.find_instance<SlowLoadWorkload>(names[i]);
+				const WorkloadInstanceInfo* info = engine.find_instance_info(names[i]);
+
+				CHECK(workload->is_setup);
+				CHECK(info->load_timings.load_ns >= 25000000u);
+
+				bool is_new_thread = true;
+				for (int j = 0; j < i; ++j)
+				{
+					if (engine.find_instance<SlowLoadWorkload>(names[j])->load_thread == workload->load_thread)
+						is_new_thread = false;
+				}
+				threads_seen += is_new_thread ? 1 : 0;
+			}
+
+			CHECK(threads_seen > 1);
+		}
+
+		SECTION("Timings are still recorded when loading sequentially")
+		{
+			Engine engine;
+			engine.load(model);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				CHECK(engine.find_instance<SlowLoadWorkload>(names[i])->load_thread == Thread::get_current_thread_id());
+				CHECK(engine.find_instance_info(names[i])->load_timings.load_ns >= 25000000u);
+			}
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/WorkloadsLayout")
+	{
+		static const FieldConfigEntry config_one[] = {{"value", "1"}};
+		static const FieldConfigEntry config_two[] = {{"value", "2"}};
+		static const WorkloadSeed workload_one{TypeId("DummyWorkload"), StringView("layout_one"), 1.0f, {}, config_one};
+		static const WorkloadSeed workload_two{TypeId("DummyWorkload"), StringView("layout_two"), 1.0f, {}, config_two};
+		static const WorkloadSeed* const root_children[] = {&workload_one, &workload_two};
+		static const WorkloadSeed root{TypeId("TestSequencedGroupWorkload"), StringView("layout_group"), 1.0f, root_children};
+
+		// model order deliberately differs from tick order (group, one, two):
+		static const WorkloadSeed* const workloads[] = {&workload_two, &workload_one, &root};
+		static const char* const tick_order_names[] = {"layout_group", "layout_one", "layout_two"};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(root);
+
+		SECTION("Interleaved keeps each workload straight after its stats")
+		{
+			Engine engine;
+			engine.load(model);
+
+			for (const char* name : tick_order_names)
+			{
+				const WorkloadInstanceInfo* info = engine.find_instance_info(name);
+				const uint8_t* stats_ptr = reinterpret_cast<const uint8_t*>(info->workload_stats);
+				CHECK(stats_ptr < info->get_ptr(engine));
+				CHECK(info->get_ptr(engine) - stats_ptr < static_cast<ptrdiff_t>(sizeof(WorkloadInstanceStats) + alignof(max_align_t)));
+			}
+		}
+
+		SECTION("CacheAware packs workloads in tick order, with stats in a cold region after them")
+		{
+			model.set_workloads_layout(WorkloadsLayout::CacheAware);
+
+			Engine engine;
+			engine.load(model);
+
+			size_t previous_offset = 0;
+			size_t hot_region_end = 0;
+			for (const char* name : tick_order_names)
+			{
+				const WorkloadInstanceInfo* info = engine.find_instance_info(name);
+				CHECK(info->offset_in_workloads_buffer >= previous_offset);
+				previous_offset = info->offset_in_workloads_buffer;
+				hot_region_end = previous_offset + info->get_size();
+			}
+
+			// nothing ticks off the tick thread, so the workloads sit back-to-back:
+			const WorkloadInstanceInfo* one_info = engine.find_instance_info("layout_one");
+			const WorkloadInstanceInfo* two_info = engine.find_instance_info("layout_two");
+			CHECK(two_info->offset_in_workloads_buffer - one_info->offset_in_workloads_buffer < sizeof(DummyWorkload) + alignof(max_align_t));
+
+			for (const char* name : tick_order_names)
+			{
+				const WorkloadInstanceInfo* info = engine.find_instance_info(name);
+				const uint8_t* stats_ptr = reinterpret_cast<const uint8_t*>(info->workload_stats);
+				CHECK(static_cast<size_t>(stats_ptr - engine.get_workloads_buffer().raw_ptr()) >= hot_region_end);
+				CHECK(reinterpret_cast<uintptr_t>(stats_ptr) % DEFAULT_CACHE_LINE_BYTES == 0);
+			}
+
+			CHECK(engine.find_instance<DummyWorkload>("layout_one")->config.value == 1);
+			CHECK(engine.find_instance<DummyWorkload>("layout_two")->config.value == 2);
+		}
+
+		SECTION("CacheAware pads workloads ticked on another thread to whole cache lines")
+		{
+			static const WorkloadPlacementSeed placement_one{"layout_one", -1, true};
+			static const WorkloadPlacementSeed* const placements[] = {&placement_one};
+			model.use_workload_placements(placements);
+			model.set_workloads_layout(WorkloadsLayout::CacheAware);
+
+			Engine engine;
+			engine.load(model);
+
+			const WorkloadInstanceInfo* one_info = engine.find_instance_info("layout_one");
+			const WorkloadInstanceInfo* two_info = engine.find_instance_info("layout_two");
+			CHECK(reinterpret_cast<uintptr_t>(one_info->get_ptr(engine)) % DEFAULT_CACHE_LINE_BYTES == 0);
+			CHECK(reinterpret_cast<uintptr_t>(two_info->get_ptr(engine)) % DEFAULT_CACHE_LINE_BYTES == 0);
+			CHECK(two_info->offset_in_workloads_buffer >= one_info->offset_in_workloads_buffer + one_info->get_size());
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/BlackboardSizing")
+	{
+		static const WorkloadSeed blackboard_seed{TypeId("BigBlackboardWorkload"), StringView("big_blackboard"), 100.0f};
+		static const WorkloadSeed counter_seed{TypeId("TickCounterWorkload"), StringView("sizing_counter"), 100.0f};
+		static const WorkloadSeed odd_sized_seed{TypeId("OddSizedWorkload"), StringView("sizing_odd_sized"), 100.0f};
+		static const WorkloadSeed* const blackboard_workloads[] = {&blackboard_seed, &odd_sized_seed};
+		static const WorkloadSeed* const counter_workloads[] = {&counter_seed};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+
+		SECTION("Blackboard storage is sized exactly, however big, once the workloads have pre-loaded")
+		{
+			model.use_workload_seeds(blackboard_workloads);
+			model.set_root_workload(blackboard_seed);
+
+			Engine engine;
+			engine.load(model);
+
+			const WorkloadsBuffer& workloads_buffer = engine.get_workloads_buffer();
+			CHECK(workloads_buffer.get_size() == workloads_buffer.get_size_used());
+			CHECK(workloads_buffer.get_size_used() > BigBlackboardState::text_field_count * sizeof(FixedString1024));
+
+			// the workload and its stats moved into the final buffer along with everything else:
+			const WorkloadInstanceInfo* info = engine.find_instance_info("big_blackboard");
+			CHECK(workloads_buffer.contains_object(info->workload_stats, sizeof(WorkloadInstanceStats)));
+			CHECK(info->workload_stats->tick_rate_hz == 100.0f);
+
+			AtomicFlag stop_flag{false};
+			engine.run_virtual_time(stop_flag, 3);
+
+			auto* workload = engine.find_instance<BigBlackboardWorkload>("big_blackboard");
+			CHECK(workload->outputs.samples.get<int>("count") == 3);
+			CHECK(info->workload_stats->tick_count == 3);
+
+			// every field's storage lies within the buffer, however its alignment pads it from where the workloads ended:
+			const Blackboard& samples = workload->outputs.samples;
+			for (const FieldDescriptor& field : samples.get_struct_descriptor().fields)
+				CHECK(workloads_buffer.contains_object(field.get_data_ptr((void*)&samples), field.find_type_descriptor()->size));
+		}
+
+		SECTION("Blackboards bound to fields within the workloads buffer are refused, rather than left dangling")
+		{
+			static const WorkloadSeed inline_fields_seed{TypeId("InlineFieldsBlackboardWorkload"), StringView("inline_fields"), 100.0f};
+			static const WorkloadSeed* const inline_fields_workloads[] = {&inline_fields_seed};
+			model.use_workload_seeds(inline_fields_workloads);
+			model.set_root_workload(inline_fields_seed);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "held within the workloads buffer");
+		}
+
+		SECTION("Without blackboards, nothing is reserved for them")
+		{
+			model.use_workload_seeds(counter_workloads);
+			model.set_root_workload(counter_seed);
+
+			Engine engine;
+			engine.load(model);
+
+			CHECK(engine.get_workloads_buffer().get_size() == engine.get_workloads_buffer().get_size_used());
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/Relocation")
+	{
+		static const WorkloadSeed self_pointing_seed{TypeId("SelfPointingWorkload"), StringView("self_pointing"), 100.0f};
+		static const WorkloadSeed blackboard_seed{TypeId("BigBlackboardWorkload"), StringView("relocated_blackboard"), 100.0f};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+
+		SECTION("Without blackboards, workloads are built in place in the final buffer, however it is allocated")
+		{
+			static const WorkloadSeed* const workloads[] = {&self_pointing_seed};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(self_pointing_seed);
+			model.set_workloads_buffer_allocation(WorkloadsBufferAllocation::LockedPages);
+
+			Engine engine;
+			engine.load(model);
+
+			const auto* workload = engine.find_instance<SelfPointingWorkload>("self_pointing");
+			CHECK(workload->self == workload);
+		}
+
+		SECTION("With blackboards, workload types that can't be relocated are refused")
+		{
+			static const WorkloadSeed* const workloads[] = {&blackboard_seed, &self_pointing_seed};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(blackboard_seed);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "'self_pointing' isn't relocatable");
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/VirtualTime")
+	{
+		static const WorkloadSeed workload_seed{TypeId("TickTraceWorkload"), StringView("virtual_trace"), 1000.0f};
+		static const WorkloadSeed* const workloads[] = {&workload_seed};
+
+		const auto run_virtual = [](Model& model, Engine& engine) -> const TickTraceWorkload*
+		{
+			model.set_telemetry_port(choose_telemetry_port());
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(workload_seed);
+
+			engine.load(model);
+
+			AtomicFlag stop_flag{false};
+			engine.run_virtual_time(stop_flag, 500);
+
+			return engine.find_instance<TickTraceWorkload>("virtual_trace");
+		};
+
+		SECTION("Ticks advance by exactly one period without waiting for real time")
+		{
+			Model model;
+			Engine engine;
+
+			const auto wall_start = Clock::now();
+			const TickTraceWorkload* trace = run_virtual(model, engine);
+			const float wall_seconds = Clock::to_nanoseconds(Clock::now() - wall_start).count() * 1e-9f;
+
+			REQUIRE(trace != nullptr);
+			CHECK(trace->tick_count == 500);
+			CHECK(trace->last_time_now_ns == 500000000ull);
+			CHECK(trace->last_delta_time == Catch::Approx(0.001f));
+			CHECK(engine.get_root_instance_info()->workload_stats->tick_count == 500);
+
+			// 500 real-time ticks would take half a second:
+			CHECK(wall_seconds < 0.25f);
+		}
+
+		SECTION("Repeated runs see identical timing")
+		{
+			Model model_a;
+			Engine engine_a;
+			const TickTraceWorkload* trace_a = run_virtual(model_a, engine_a);
+
+			Model model_b;
+			Engine engine_b;
+			const TickTraceWorkload* trace_b = run_virtual(model_b, engine_b);
+
+			REQUIRE(trace_a != nullptr);
+			REQUIRE(trace_b != nullptr);
+			CHECK(trace_a->checksum == trace_b->checksum);
+		}
+
+		SECTION("Every frame is published as a snapshot when the model has snapshot readers")
+		{
+			Model model;
+			model.set_snapshot_reader_count(1);
+			Engine engine;
+			const TickTraceWorkload* trace = run_virtual(model, engine);
+			REQUIRE(trace != nullptr);
+
+			WorkloadsBufferSnapshots& snapshots = engine.get_workloads_buffer_snapshots();
+			CHECK(snapshots.get_published_count() == 500);
+			CHECK(snapshots.get_skipped_publish_count() == 0);
+
+			WorkloadsBufferSnapshots::Lease snapshot = snapshots.acquire();
+			REQUIRE(snapshot.is_valid());
+			REQUIRE(snapshot.size() == engine.get_workloads_buffer().get_size_used());
+
+			const size_t trace_offset = engine.find_instance_info("virtual_trace")->offset_in_workloads_buffer;
+			TickTraceWorkload trace_copy;
+			::memcpy(&trace_copy, snapshot.data() + trace_offset, sizeof(trace_copy));
+			CHECK(trace_copy.tick_count == 500);
+			CHECK(trace_copy.checksum == trace->checksum);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Engine/StopLatency")
+	{
+		// 1Hz, so a stop that waited out the period would take the best part of a second:
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		static const WorkloadSeed workload_seed{TypeId("TickCounterWorkload"), StringView("slow_ticker"), 1.0f};
+		static const WorkloadSeed* const workloads[] = {&workload_seed};
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(workload_seed);
+
+		Engine engine;
+		engine.load(model);
+
+		const TickCounterWorkload* ticker = engine.find_instance<TickCounterWorkload>("slow_ticker");
+		REQUIRE(ticker != nullptr);
+
+		SECTION("Setting the stop flag wakes the sleeping run")
+		{
+			AtomicFlag stop_flag{false};
+			{
+				EngineRunThread runner(engine, stop_flag);
+				Thread::sleep_ms(50); // the first tick is due straight away, then the run sleeps until the next
+
+				const auto stop_time = Clock::now();
+				stop_flag.set();
+
+				while (engine.is_running() && Clock::now() - stop_time < Clock::from_seconds(2.0f))
+					Thread::sleep_ms(1);
+
+				CHECK(Clock::now() - stop_time < Clock::from_seconds(0.25f));
+			}
+
+			CHECK_FALSE(engine.is_running());
+			CHECK(ticker->count == 1); // stopped while sleeping, so without another tick
+		}
+
+		SECTION("stop() returns once the run has finished")
+		{
+			AtomicFlag stop_flag{false};
+			EngineRunThread runner(engine, stop_flag);
+			Thread::sleep_ms(50);
+
+			const auto stop_time = Clock::now();
+			CHECK(engine.stop(Clock::from_seconds(0.5f)));
+			CHECK(Clock::now() - stop_time < Clock::from_seconds(0.25f));
+			CHECK_FALSE(engine.is_running());
+			CHECK(ticker->count == 1);
+		}
+
+		SECTION("stop() before a run starts is held for it, rather than lost")
+		{
+			CHECK(engine.stop(Clock::from_seconds(0.01f))); // nothing running yet
+			CHECK(engine.is_stop_requested());
+
+			AtomicFlag stop_flag{false};
+			{
+				EngineRunThread runner(engine, stop_flag);
+
+				// (the run should stop by itself after its first tick - the stop flag only keeps a failure from hanging)
+				const auto start_time = Clock::now();
+				while ((ticker->count == 0 || engine.is_running()) && Clock::now() - start_time < Clock::from_seconds(0.5f))
+					Thread::sleep_ms(1);
+
+				CHECK(ticker->count == 1);
+				CHECK_FALSE(engine.is_running());
+				stop_flag.set();
+			}
+
+			// and the request went with the run it stopped:
+			CHECK_FALSE(engine.is_stop_requested());
+		}
+	}
+
 } // namespace robotick::test
@@ -43,6 +43,12 @@ namespace robotick::test
 		};
 
 		ROBOTICK_REGISTER_WORKLOAD(SimpleWorkload, void, SimpleInputs, SimpleOutputs)
+
+		struct TraversalGroupWorkload
+		{
+		};
+
+		ROBOTICK_REGISTER_WORKLOAD(TraversalGroupWorkload)
 	} // namespace
 
 	TEST_CASE("Unit/Framework/WorkloadFieldsIterator")
@@ -246,6 +252,44 @@ namespace robotick::test
 			CHECK(input_hits == 1);
 			CHECK(output_hits == 1);
 		}
+
+		SECTION("for_each_field_in_workload visits every element of an instanced workload")
+		{
+			Model model;
+			static const WorkloadSeed w{TypeId("SimpleWorkload"), StringView("W_instanced"), WorkloadInstanceCount(3), 10.0f};
+			static const WorkloadSeed* root_children[] = {&w};
+			static const WorkloadSeed root{TypeId("TraversalGroupWorkload"), StringView("W_group"), 10.0f, root_children};
+			static const WorkloadSeed* workloads[] = {&w, &root};
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			const WorkloadInstanceInfo& info = *engine.find_instance_info("W_instanced");
+			REQUIRE(info.instance_count == 3);
+
+			auto* elements = static_cast<SimpleWorkload*>((void*)info.get_ptr(engine));
+			for (int i = 0; i < 3; ++i)
+				elements[i].inputs.input_value = 10 * i;
+
+			int input_hits = 0;
+			WorkloadFieldsIterator::for_each_field_in_workload(engine,
+				info,
+				nullptr,
+				[&](const WorkloadFieldView& view)
+				{
+					if (!string_equals(view.field_info->name.c_str(), "input_value"))
+						return;
+
+					REQUIRE(view.element_index < 3);
+					CHECK(view.field_ptr == &elements[view.element_index].inputs.input_value);
+					CHECK(*static_cast<int*>(view.field_ptr) == 10 * static_cast<int>(view.element_index));
+					++input_hits;
+				});
+
+			CHECK(input_hits == 3);
+		}
 	}
 
 } // namespace robotick::test
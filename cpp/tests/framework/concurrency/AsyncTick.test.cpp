@@ -0,0 +1,230 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/AsyncTick.h"
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/IoReactor.h"
+#include "robotick/framework/model/Model.h"
+#include "robotick/framework/registry/TypeRegistry.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <unistd.h>
+
+namespace robotick::test
+{
+	namespace
+	{
+		// runs its tick body in three parts: up to a yield, up to an await on `gate`, then to the end
+		struct AsyncStagedWorkload
+		{
+			AsyncTickState async_state;
+			bool gate = false;
+			int stage = 0;
+			int completed_count = 0;
+
+			AsyncTickStatus tick(const TickInfo&)
+			{
+				ROBOTICK_ASYNC_BEGIN(async_state);
+				stage = 1;
+				ROBOTICK_ASYNC_YIELD(async_state);
+				stage = 2;
+				ROBOTICK_ASYNC_AWAIT(async_state, gate);
+				stage = 3;
+				completed_count++;
+				ROBOTICK_ASYNC_END(async_state);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(AsyncStagedWorkload)
+
+		// reads one byte from read_fd each time the engine's IoReactor reports it readable
+		struct AsyncPipeReaderWorkload
+		{
+			const Engine* engine = nullptr;
+			AsyncTickState async_state;
+			int read_fd = -1;
+			uint32_t watch_id = IoReactor::INVALID_WATCH;
+			int tick_count = 0;
+			int bytes_read = 0;
+			char last_byte = 0;
+
+			void set_engine(const Engine& in_engine) { engine = &in_engine; }
+
+			AsyncTickStatus tick(const TickInfo&)
+			{
+				tick_count++;
+
+				ROBOTICK_ASYNC_BEGIN(async_state);
+				ROBOTICK_ASYNC_AWAIT_IO(async_state, engine->get_io_reactor(), watch_id);
+				if (::read(read_fd, &last_byte, 1) == 1)
+					bytes_read++;
+				ROBOTICK_ASYNC_END(async_state);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(AsyncPipeReaderWorkload)
+
+		struct AsyncPlainWorkload
+		{
+			void tick(const TickInfo&) {}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(AsyncPlainWorkload)
+
+		struct AsyncContainerWorkload
+		{
+		};
+		ROBOTICK_REGISTER_WORKLOAD(AsyncContainerWorkload)
+
+		TickInfo make_tick_info(uint64_t tick_count)
+		{
+			TickInfo tick_info;
+			tick_info.tick_count = tick_count;
+			tick_info.tick_rate_hz = 100.0f;
+			tick_info.time_now_ns = tick_count * 10000000ull;
+			return tick_info;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Concurrency/AsyncTick")
+	{
+		SECTION("Only workloads whose tick() returns AsyncTickStatus are async")
+		{
+			const TypeDescriptor* async_type = TypeRegistry::get().find_by_name("AsyncStagedWorkload");
+			const TypeDescriptor* plain_type = TypeRegistry::get().find_by_name("AsyncPlainWorkload");
+			REQUIRE(async_type != nullptr);
+			REQUIRE(plain_type != nullptr);
+
+			CHECK(async_type->get_workload_desc()->async_tick_fn != nullptr);
+			CHECK(async_type->get_workload_desc()->tick_fn != nullptr);
+			CHECK(plain_type->get_workload_desc()->async_tick_fn == nullptr);
+		}
+
+		SECTION("A tick body resumes where it last suspended")
+		{
+			static const WorkloadSeed staged{TypeId("AsyncStagedWorkload"), StringView("async_staged"), 100.0f};
+			static const WorkloadSeed* const workloads[] = {&staged};
+
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(staged);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			auto* staged_ptr = engine.find_instance<AsyncStagedWorkload>("async_staged");
+			tick_plan.start();
+
+			tick_plan.tick_root(make_tick_info(1));
+			CHECK(staged_ptr->stage == 1);
+			CHECK(staged_ptr->async_state.is_suspended());
+
+			// resumes after the yield, then waits on the gate for as many ticks as it takes:
+			tick_plan.tick_root(make_tick_info(2));
+			tick_plan.tick_root(make_tick_info(3));
+			CHECK(staged_ptr->stage == 2);
+
+			staged_ptr->gate = true;
+			tick_plan.tick_root(make_tick_info(4));
+			CHECK(staged_ptr->stage == 3);
+			CHECK(staged_ptr->completed_count == 1);
+			CHECK_FALSE(staged_ptr->async_state.is_suspended());
+
+			// and the next tick starts from the top again:
+			tick_plan.tick_root(make_tick_info(5));
+			CHECK(staged_ptr->stage == 1);
+		}
+
+		SECTION("Each element of an instanced async workload resumes where it suspended")
+		{
+			static const WorkloadSeed staged{TypeId("AsyncStagedWorkload"), StringView("async_staged_instanced"), WorkloadInstanceCount(2), 100.0f};
+			static const WorkloadSeed* const root_children[] = {&staged};
+			static const WorkloadSeed root{TypeId("AsyncContainerWorkload"), StringView("async_instanced_root"), 100.0f, root_children};
+			static const WorkloadSeed* const workloads[] = {&staged, &root};
+
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			auto* elements = engine.find_instance<AsyncStagedWorkload>("async_staged_instanced");
+			tick_plan.start();
+
+			tick_plan.tick_root(make_tick_info(1));
+			tick_plan.tick_root(make_tick_info(2));
+			CHECK(elements[0].stage == 2);
+			CHECK(elements[1].stage == 2);
+
+			// only the first element's gate opens - the second keeps waiting on its own:
+			elements[0].gate = true;
+			tick_plan.tick_root(make_tick_info(3));
+			CHECK(elements[0].completed_count == 1);
+			CHECK(elements[1].completed_count == 0);
+			CHECK(elements[1].async_state.is_suspended());
+
+			elements[1].gate = true;
+			tick_plan.tick_root(make_tick_info(4));
+			CHECK(elements[0].stage == 1);
+			CHECK(elements[1].completed_count == 1);
+		}
+
+		SECTION("A workload awaiting I/O is skipped until its fd becomes ready")
+		{
+			static const WorkloadSeed reader{TypeId("AsyncPipeReaderWorkload"), StringView("async_reader"), 100.0f};
+			static const WorkloadSeed* const root_children[] = {&reader};
+			static const WorkloadSeed root{TypeId("AsyncContainerWorkload"), StringView("async_root"), 100.0f, root_children};
+			static const WorkloadSeed* const workloads[] = {&reader, &root};
+
+			Model model;
+			model.set_telemetry_port(choose_telemetry_port());
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			int pipe_fds[2] = {-1, -1};
+			REQUIRE(::pipe(pipe_fds) == 0);
+
+			auto* reader_ptr = engine.find_instance<AsyncPipeReaderWorkload>("async_reader");
+			reader_ptr->read_fd = pipe_fds[0];
+			reader_ptr->watch_id = engine.get_io_reactor().watch(pipe_fds[0], IoEvents::Readable, reader_ptr);
+
+			engine.begin_stepped_run();
+
+			// suspends on its first tick, and is then left alone while nothing arrives:
+			engine.step();
+			engine.step();
+			engine.step();
+			CHECK(reader_ptr->tick_count == 1);
+			CHECK(reader_ptr->bytes_read == 0);
+
+			const char byte = 'x';
+			REQUIRE(::write(pipe_fds[1], &byte, 1) == 1);
+
+			engine.step();
+			CHECK(reader_ptr->tick_count == 2);
+			CHECK(reader_ptr->bytes_read == 1);
+			CHECK(reader_ptr->last_byte == 'x');
+
+			// the next tick starts over and suspends again, the pipe now being empty:
+			engine.step();
+			engine.step();
+			CHECK(reader_ptr->tick_count == 3);
+			CHECK(reader_ptr->bytes_read == 1);
+
+			engine.end_stepped_run();
+
+			engine.get_io_reactor().unwatch(reader_ptr->watch_id);
+			CHECK(engine.get_io_reactor().get_watch_count() == 0);
+
+			::close(pipe_fds[0]);
+			::close(pipe_fds[1]);
+		}
+	}
+
+} // namespace robotick::test
@@ -0,0 +1,84 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct DelayedSignal
+		{
+			AtomicFlag* flag = nullptr;
+			bool set_flag = true; // else just wake its waiters
+
+			static void entry(void* arg)
+			{
+				auto* signal = static_cast<DelayedSignal*>(arg);
+				Thread::sleep_ms(20);
+				if (signal->set_flag)
+					signal->flag->set();
+				else
+					signal->flag->wake_waiters();
+			}
+		};
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Concurrency/AtomicFlag")
+	{
+		SECTION("set, clear and test_and_set")
+		{
+			AtomicFlag flag;
+			CHECK_FALSE(flag.is_set());
+			CHECK_FALSE(flag.test_and_set());
+			CHECK(flag.test_and_set());
+			flag.clear();
+			CHECK_FALSE(flag.is_set());
+			flag.set(true);
+			CHECK(flag.is_set());
+			flag.set(false);
+			CHECK_FALSE(flag.is_set());
+		}
+
+		SECTION("wait_until returns straight away for a set flag, or at the deadline")
+		{
+			AtomicFlag set_flag{true};
+			CHECK(set_flag.wait_until(Clock::now() + Clock::from_seconds(5.0f)));
+
+			AtomicFlag unset_flag;
+			const auto start = Clock::now();
+			CHECK_FALSE(unset_flag.wait_until(start + Clock::from_seconds(0.02f)));
+			CHECK(Clock::now() - start >= Clock::from_seconds(0.02f));
+		}
+
+		SECTION("set() and wake_waiters() wake a waiting thread well before its deadline")
+		{
+			for (const bool set_flag : {true, false})
+			{
+				AtomicFlag flag;
+				DelayedSignal signal{&flag, set_flag};
+
+				const auto start = Clock::now();
+				Thread signaller(&DelayedSignal::entry, &signal, "DelayedSignal");
+
+				CHECK(flag.wait_until(start + Clock::from_seconds(5.0f)) == set_flag);
+				CHECK(Clock::now() - start < Clock::from_seconds(1.0f));
+
+				if (signaller.is_joining_supported() && signaller.is_joinable())
+					signaller.join();
+
+				// a set flag keeps waking later waiters (and clear() leaves it waitable again):
+				if (set_flag)
+				{
+					CHECK(flag.wait_until(Clock::now() + Clock::from_seconds(5.0f)));
+					flag.clear();
+					CHECK_FALSE(flag.wait_until(Clock::now() + Clock::from_seconds(0.005f)));
+				}
+			}
+		}
+	}
+
+} // namespace robotick::test
@@ -0,0 +1,114 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/IoReactor.h"
+#include "robotick/config/AssertUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <unistd.h>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct WakeLog
+		{
+			int wake_count = 0;
+			const void* last_owner = nullptr;
+
+			static void on_wake(void* context, const void* owner_ptr)
+			{
+				WakeLog* log = static_cast<WakeLog*>(context);
+				log->wake_count++;
+				log->last_owner = owner_ptr;
+			}
+		};
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Concurrency/IoReactor")
+	{
+		int pipe_fds[2] = {-1, -1};
+		REQUIRE(::pipe(pipe_fds) == 0);
+
+		IoReactor reactor;
+		WakeLog log;
+		const int owner = 0;
+
+		const uint32_t watch_id = reactor.watch(pipe_fds[0], IoEvents::Readable, &owner);
+		REQUIRE(watch_id != IoReactor::INVALID_WATCH);
+		CHECK(reactor.get_watch_count() == 1);
+
+		SECTION("Nothing is ready until data arrives")
+		{
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.wake_count == 0);
+			CHECK_FALSE(reactor.consume_ready(watch_id));
+		}
+
+		SECTION("Readiness wakes the owner once, and is latched until consumed")
+		{
+			const char byte = 'x';
+			REQUIRE(::write(pipe_fds[1], &byte, 1) == 1);
+
+			reactor.poll(&WakeLog::on_wake, &log);
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.wake_count == 1);
+			CHECK(log.last_owner == &owner);
+
+			CHECK(reactor.consume_ready(watch_id));
+			CHECK_FALSE(reactor.consume_ready(watch_id));
+
+			// still unread, so the next poll reports it again:
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.wake_count == 2);
+		}
+
+		SECTION("Unwatched fds are no longer reported")
+		{
+			reactor.unwatch(watch_id);
+			CHECK(reactor.get_watch_count() == 0);
+
+			const char byte = 'x';
+			REQUIRE(::write(pipe_fds[1], &byte, 1) == 1);
+
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.wake_count == 0);
+		}
+
+		SECTION("Owners within a moved range are rebased, and others left be")
+		{
+			int moved_pipe_fds[2] = {-1, -1};
+			REQUIRE(::pipe(moved_pipe_fds) == 0);
+
+			const int old_range[4] = {};
+			const int new_range[4] = {};
+			const uint32_t moved_watch_id = reactor.watch(moved_pipe_fds[0], IoEvents::Readable, &old_range[2]);
+
+			reactor.rebase_owners(old_range, sizeof(old_range), new_range);
+
+			const char byte = 'x';
+			REQUIRE(::write(pipe_fds[1], &byte, 1) == 1);
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.last_owner == &owner);
+
+			REQUIRE(::write(moved_pipe_fds[1], &byte, 1) == 1);
+			reactor.poll(&WakeLog::on_wake, &log);
+			CHECK(log.wake_count == 2);
+			CHECK(log.last_owner == &new_range[2]);
+
+			reactor.unwatch(moved_watch_id);
+			::close(moved_pipe_fds[0]);
+			::close(moved_pipe_fds[1]);
+		}
+
+		SECTION("Invalid fds are rejected")
+		{
+			ROBOTICK_REQUIRE_ERROR_MSG(reactor.watch(-1, IoEvents::Readable, &owner), "invalid fd");
+		}
+
+		reactor.unwatch(watch_id);
+		::close(pipe_fds[0]);
+		::close(pipe_fds[1]);
+	}
+
+} // namespace robotick::test
@@ -0,0 +1,192 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/concurrency/WorkerPool.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/concurrency/WorkStealingDeque.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct CountingContext
+		{
+			AtomicValue<uint32_t> run_counts[32];
+			AtomicValue<uint32_t> concurrent_now{0};
+			AtomicValue<uint32_t> max_concurrent{0};
+			uint32_t sleep_ms = 0;
+		};
+
+		void counting_task(void* context, uint32_t index)
+		{
+			auto* ctx = static_cast<CountingContext*>(context);
+
+			const uint32_t concurrent = ctx->concurrent_now.fetch_add(1) + 1;
+			uint32_t observed_max = ctx->max_concurrent.load();
+			while (concurrent > observed_max && !ctx->max_concurrent.compare_exchange_weak(observed_max, concurrent))
+			{
+			}
+
+			if (ctx->sleep_ms > 0)
+				Thread::sleep_ms(ctx->sleep_ms);
+
+			ctx->run_counts[index].fetch_add(1);
+			ctx->concurrent_now.fetch_sub(1);
+		}
+
+		struct NestedContext
+		{
+			WorkerPool* pool = nullptr;
+			CountingContext inner_context;
+			WorkerTask inner_tasks[4];
+			WorkerTask* inner_task_ptrs[4] = {};
+			AtomicValue<uint32_t> outer_runs{0};
+		};
+
+		void nested_task(void* context, uint32_t)
+		{
+			auto* ctx = static_cast<NestedContext*>(context);
+			ctx->pool->run_and_wait(ctx->inner_task_ptrs, 4);
+			ctx->outer_runs.fetch_add(1);
+		}
+
+		void make_tasks(CountingContext& context, WorkerTask* tasks, WorkerTask** task_ptrs, uint32_t count)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				tasks[i].fn = &counting_task;
+				tasks[i].context = &context;
+				tasks[i].index = i;
+				task_ptrs[i] = &tasks[i];
+			}
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Concurrency/WorkStealingDeque")
+	{
+		WorkStealingDeque<int*, 4> deque;
+		int values[5] = {0, 1, 2, 3, 4};
+
+		SECTION("Owner pops LIFO, thieves steal FIFO")
+		{
+			REQUIRE(deque.push(&values[0]));
+			REQUIRE(deque.push(&values[1]));
+			REQUIRE(deque.push(&values[2]));
+
+			int* item = nullptr;
+			REQUIRE(deque.pop(item));
+			CHECK(item == &values[2]);
+
+			REQUIRE(deque.steal(item));
+			CHECK(item == &values[0]);
+
+			REQUIRE(deque.pop(item));
+			CHECK(item == &values[1]);
+
+			CHECK_FALSE(deque.pop(item));
+			CHECK_FALSE(deque.steal(item));
+			CHECK(deque.is_empty());
+		}
+
+		SECTION("Push fails rather than growing when full")
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				REQUIRE(deque.push(&values[i]));
+			}
+			CHECK_FALSE(deque.push(&values[4]));
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Concurrency/WorkerPool")
+	{
+		CountingContext context;
+		WorkerTask tasks[32];
+		WorkerTask* task_ptrs[32] = {};
+
+		SECTION("Runs every task exactly once inline when not started")
+		{
+			WorkerPool pool;
+			make_tasks(context, tasks, task_ptrs, 8);
+			pool.run_and_wait(task_ptrs, 8);
+
+			for (uint32_t i = 0; i < 8; ++i)
+			{
+				CHECK(context.run_counts[i].load() == 1);
+			}
+			CHECK(context.max_concurrent.load() == 1);
+		}
+
+		SECTION("Runs tasks concurrently and waits for all of them")
+		{
+			WorkerPool pool;
+			pool.start(4);
+			REQUIRE(pool.is_running());
+
+			context.sleep_ms = 20;
+			make_tasks(context, tasks, task_ptrs, 4);
+			pool.run_and_wait(task_ptrs, 4);
+
+			for (uint32_t i = 0; i < 4; ++i)
+			{
+				CHECK(context.run_counts[i].load() == 1);
+			}
+			CHECK(context.concurrent_now.load() == 0);
+			CHECK(context.max_concurrent.load() > 1);
+
+			pool.stop();
+			CHECK_FALSE(pool.is_running());
+		}
+
+		SECTION("Repeated batches reuse the same tasks")
+		{
+			WorkerPool pool;
+			pool.start(3);
+
+			make_tasks(context, tasks, task_ptrs, 32);
+			for (int batch = 0; batch < 200; ++batch)
+			{
+				pool.run_and_wait(task_ptrs, 32);
+			}
+
+			for (uint32_t i = 0; i < 32; ++i)
+			{
+				CHECK(context.run_counts[i].load() == 200);
+			}
+		}
+
+		SECTION("Tasks can fan out further from worker threads")
+		{
+			WorkerPool pool;
+			pool.start(2);
+
+			NestedContext nested[2];
+			WorkerTask outer_tasks[2];
+			WorkerTask* outer_task_ptrs[2] = {};
+
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				nested[i].pool = &pool;
+				make_tasks(nested[i].inner_context, nested[i].inner_tasks, nested[i].inner_task_ptrs, 4);
+
+				outer_tasks[i].fn = &nested_task;
+				outer_tasks[i].context = &nested[i];
+				outer_task_ptrs[i] = &outer_tasks[i];
+			}
+
+			pool.run_and_wait(outer_task_ptrs, 2);
+
+			for (uint32_t i = 0; i < 2; ++i)
+			{
+				CHECK(nested[i].outer_runs.load() == 1);
+				for (uint32_t j = 0; j < 4; ++j)
+				{
+					CHECK(nested[i].inner_context.run_counts[j].load() == 1);
+				}
+			}
+		}
+	}
+
+} // namespace robotick::test
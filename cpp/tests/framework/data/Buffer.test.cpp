@@ -141,4 +141,31 @@ TEST_CASE("Unit/Framework/Data/Buffer")
 		REQUIRE(moved.get_size_used() == 32);
 		REQUIRE((moved.get_telemetry_frame_seq() % 2) == 0);
 	}
+
+	SECTION("WorkloadsBuffer can live on locked pages, zeroed and cache-line aligned", "[buffer][locked]")
+	{
+		const size_t size = 3 * 1024 * 1024; // big enough to be offered (transparent) huge pages
+
+		WorkloadsBuffer buffer(size, WorkloadsBufferAllocation::LockedPages);
+		REQUIRE(buffer.get_size() == size);
+		REQUIRE(reinterpret_cast<uintptr_t>(buffer.raw_ptr()) % DEFAULT_CACHE_LINE_BYTES == 0);
+
+		// mapped on Linux (locked only if RLIMIT_MEMLOCK allows); otherwise the heap, which is never locked:
+		CHECK((buffer.is_mapped() || !buffer.is_locked()));
+
+		CHECK(buffer.raw_ptr()[0] == 0);
+		CHECK(buffer.raw_ptr()[size - 1] == 0);
+		buffer.raw_ptr()[size - 1] = 0xAB;
+
+		WorkloadsBuffer moved = robotick::move(buffer);
+		CHECK(moved.raw_ptr()[size - 1] == 0xAB);
+		CHECK_FALSE(buffer.is_mapped());
+	}
+
+	SECTION("Heap buffers are never mapped or locked", "[buffer][locked]")
+	{
+		RawBuffer buffer(64);
+		CHECK_FALSE(buffer.is_mapped());
+		CHECK_FALSE(buffer.is_locked());
+	}
 }
@@ -49,6 +49,8 @@ namespace robotick::test
 
 		struct DummyA
 		{
+			static constexpr bool is_relocatable = true; // (its State<> only points at the heap)
+
 			DummyAOutput outputs;
 			State<DummyState> state;
 
@@ -71,6 +73,8 @@ namespace robotick::test
 
 		struct DummyB
 		{
+			static constexpr bool is_relocatable = true; // (its State<> only points at the heap)
+
 			DummyBInput inputs;
 			State<DummyState> state;
 
@@ -0,0 +1,284 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/DirtyRegionTracker.h"
+#include "robotick/api.h"
+#include "robotick/config/AssertUtils.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/WorkloadInstanceInfo.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
+#include "robotick/framework/model/Model.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <cstring>
+
+namespace robotick::test
+{
+	namespace
+	{
+		constexpr size_t LINE = DirtyRegionTracker::LINE_BYTES;
+
+		struct DirtyTrackConfig
+		{
+			FixedString256 label; // big enough to fill lines of its own
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(DirtyTrackConfig)
+		ROBOTICK_STRUCT_FIELD(DirtyTrackConfig, FixedString256, label)
+		ROBOTICK_REGISTER_STRUCT_END(DirtyTrackConfig)
+
+		struct DirtyTrackValue
+		{
+			int value = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(DirtyTrackValue)
+		ROBOTICK_STRUCT_FIELD(DirtyTrackValue, int, value)
+		ROBOTICK_REGISTER_STRUCT_END(DirtyTrackValue)
+
+		struct DirtyTrackGroupWorkload
+		{
+		};
+		ROBOTICK_REGISTER_WORKLOAD(DirtyTrackGroupWorkload)
+
+		struct DirtyTrackCounterWorkload
+		{
+			DirtyTrackConfig config;
+			DirtyTrackValue outputs;
+			void tick(const TickInfo&) { outputs.value++; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(DirtyTrackCounterWorkload, DirtyTrackConfig, void, DirtyTrackValue)
+
+		struct DirtyTrackSinkWorkload
+		{
+			DirtyTrackConfig config;
+			DirtyTrackValue inputs;
+		};
+		ROBOTICK_REGISTER_WORKLOAD(DirtyTrackSinkWorkload, DirtyTrackConfig, DirtyTrackValue)
+
+		// ticks its children itself, rather than leaving them to the tick plan
+		struct DirtyTrackSelfTickingWorkload
+		{
+			const Engine* engine = nullptr;
+			const HeapVector<const WorkloadInstanceInfo*>* children = nullptr;
+
+			void set_engine(const Engine& in_engine) { engine = &in_engine; }
+
+			void set_children(const HeapVector<const WorkloadInstanceInfo*>& in_children, HeapVector<DataConnectionInfo>&)
+			{
+				children = &in_children;
+			}
+
+			void tick(const TickInfo& tick_info)
+			{
+				for (const WorkloadInstanceInfo* child : *children)
+				{
+					if (child->workload_descriptor->tick_fn)
+						child->workload_descriptor->tick_fn(child->get_ptr(*engine), tick_info);
+				}
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(DirtyTrackSelfTickingWorkload)
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Data/DirtyRegionTracker")
+	{
+		RawBuffer buffer(LINE * 200);
+		DirtyRegionTracker tracker;
+
+		SECTION("Marks are no-ops until initialized")
+		{
+			tracker.mark_dirty(buffer.raw_ptr(), 16);
+			CHECK_FALSE(tracker.is_initialized());
+			CHECK(tracker.get_dirty_line_count() == 0);
+		}
+
+		SECTION("Ranges mark every line they touch, coalescing neighbours and clamping to the tracked bytes")
+		{
+			tracker.initialize(buffer, LINE * 150 + 10); // a partial last line, and a word boundary at line 64
+			CHECK(tracker.get_word_count() == 3);
+
+			tracker.mark_dirty(buffer.raw_ptr() + LINE - 1, 2); // straddles lines 0 and 1
+			tracker.mark_dirty_range(LINE * 2, LINE);			// line 2 - joins the run
+			tracker.mark_dirty_range(LINE * 60, LINE * 10);		// lines 60-69, across the word boundary
+			tracker.mark_dirty_range(LINE * 150, LINE * 40);	// the partial last line only
+			tracker.mark_dirty_range(LINE * 180, 4);			// beyond the tracked bytes - ignored
+
+			int not_in_buffer = 0;
+			tracker.mark_dirty(&not_in_buffer, sizeof(not_in_buffer));
+
+			CHECK(tracker.get_dirty_line_count() == 3 + 10 + 1);
+			CHECK(tracker.is_dirty(0));
+			CHECK(tracker.is_dirty(LINE * 2 + 5));
+			CHECK_FALSE(tracker.is_dirty(LINE * 3));
+			CHECK(tracker.is_dirty(LINE * 64));
+
+			size_t ranges[3][2] = {};
+			size_t range_count = 0;
+			tracker.for_each_dirty_range(
+				[&](size_t offset, size_t size)
+				{
+					REQUIRE(range_count < 3);
+					ranges[range_count][0] = offset;
+					ranges[range_count][1] = size;
+					range_count++;
+				});
+
+			REQUIRE(range_count == 3);
+			CHECK(ranges[0][0] == 0);
+			CHECK(ranges[0][1] == LINE * 3);
+			CHECK(ranges[1][0] == LINE * 60);
+			CHECK(ranges[1][1] == LINE * 10);
+			CHECK(ranges[2][0] == LINE * 150);
+			CHECK(ranges[2][1] == 10);
+
+			HeapVector<uint64_t> accumulated;
+			accumulated.initialize(tracker.get_word_count());
+			for (uint64_t& word : accumulated)
+				word = 0;
+
+			tracker.accumulate_into(accumulated);
+			tracker.clear();
+			CHECK(tracker.get_dirty_line_count() == 0);
+
+			tracker.mark_dirty_range(LINE * 100, 1);
+			tracker.accumulate_into(accumulated);
+
+			size_t accumulated_bytes = 0;
+			DirtyRegionTracker::for_each_range(accumulated, tracker.get_tracked_size(), [&](size_t, size_t size) { accumulated_bytes += size; });
+			CHECK(accumulated_bytes == LINE * 3 + LINE * 10 + 10 + LINE);
+		}
+
+		SECTION("Mirrors can copy just the dirty lines")
+		{
+			RawBuffer mirror;
+			mirror.create_mirror_from(buffer);
+			tracker.initialize(buffer, buffer.get_size());
+
+			buffer.raw_ptr()[LINE * 5] = 1;
+			buffer.raw_ptr()[LINE * 9] = 2;
+			tracker.mark_dirty(buffer.raw_ptr() + LINE * 5, 1);
+
+			mirror.update_mirror_from(buffer, tracker);
+			CHECK(mirror.raw_ptr()[LINE * 5] == 1);
+			CHECK(mirror.raw_ptr()[LINE * 9] == 0); // written, but never marked
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Data/DirtyRegionTracker/Engine")
+	{
+		static const WorkloadSeed counter{TypeId("DirtyTrackCounterWorkload"), StringView("dirty_counter"), 100.0f};
+		static const WorkloadSeed sink{TypeId("DirtyTrackSinkWorkload"), StringView("dirty_sink"), 100.0f};
+		static const WorkloadSeed* const root_children[] = {&counter, &sink};
+		static const WorkloadSeed root{TypeId("DirtyTrackGroupWorkload"), StringView("dirty_root"), 100.0f, root_children};
+		static const WorkloadSeed* const workloads[] = {&counter, &sink, &root};
+
+		static const DataConnectionSeed counter_to_sink("dirty_counter.outputs.value", "dirty_sink.inputs.value");
+		static const DataConnectionSeed* const connections[] = {&counter_to_sink};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.use_data_connection_seeds(connections);
+		model.set_root_workload(root);
+		model.set_dirty_region_tracking_enabled(true);
+		model.set_snapshot_reader_count(1);
+		model.set_snapshot_dirty_copy_enabled(true);
+
+		Engine engine;
+		engine.load(model);
+
+		AtomicFlag stop_flag{false};
+		engine.run_virtual_time(stop_flag, 3);
+
+		const DirtyRegionTracker& dirty_regions = engine.get_dirty_regions();
+		REQUIRE(dirty_regions.is_initialized());
+
+		const uint8_t* buffer_begin = engine.get_workloads_buffer().raw_ptr();
+		const auto offset_of = [&](const void* ptr) { return static_cast<size_t>(static_cast<const uint8_t*>(ptr) - buffer_begin); };
+
+		auto* counter_ptr = engine.find_instance<DirtyTrackCounterWorkload>("dirty_counter");
+		auto* sink_ptr = engine.find_instance<DirtyTrackSinkWorkload>("dirty_sink");
+		REQUIRE(counter_ptr->outputs.value == 3);
+
+		SECTION("The last frame's outputs, stats and changed connections are dirty - config is not")
+		{
+			CHECK(dirty_regions.is_dirty(offset_of(&counter_ptr->outputs.value)));
+			CHECK(dirty_regions.is_dirty(offset_of(&sink_ptr->inputs.value)));
+			CHECK(dirty_regions.is_dirty(offset_of(engine.find_instance_info("dirty_counter")->workload_stats)));
+			CHECK(dirty_regions.is_dirty(offset_of(engine.find_instance_info("dirty_root")->workload_stats)));
+
+			// (away from the ends of the labels, whose lines may be shared with neighbouring stats or outputs)
+			CHECK_FALSE(dirty_regions.is_dirty(offset_of(&counter_ptr->config.label) + LINE * 2));
+			CHECK_FALSE(dirty_regions.is_dirty(offset_of(&sink_ptr->config.label) + LINE * 2));
+			CHECK(dirty_regions.get_dirty_line_count() * LINE < engine.get_workloads_buffer().get_size_used());
+		}
+
+		SECTION("Snapshots copying only dirty lines still match the buffer where it is tracked")
+		{
+			WorkloadsBufferSnapshots::Lease snapshot = engine.get_workloads_buffer_snapshots().acquire();
+			REQUIRE(snapshot.is_valid());
+
+			int snapshot_value = 0;
+			::memcpy(&snapshot_value, snapshot.data() + offset_of(&sink_ptr->inputs.value), sizeof(snapshot_value));
+			CHECK(snapshot_value == 3);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Data/DirtyRegionTracker/SelfTickingRoot")
+	{
+		static const WorkloadSeed counter{TypeId("DirtyTrackCounterWorkload"), StringView("self_counter"), 100.0f};
+		static const WorkloadSeed* const root_children[] = {&counter};
+		static const WorkloadSeed root{TypeId("DirtyTrackSelfTickingWorkload"), StringView("self_root"), 100.0f, root_children};
+		static const WorkloadSeed* const workloads[] = {&counter, &root};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(root);
+		model.set_dirty_region_tracking_enabled(true);
+		model.set_snapshot_reader_count(1);
+
+		SECTION("Everything under a root that ticks its own children is dirty")
+		{
+			model.set_snapshot_dirty_copy_enabled(true);
+
+			Engine engine;
+			engine.load(model);
+
+			AtomicFlag stop_flag{false};
+			engine.run_virtual_time(stop_flag, 3);
+
+			const WorkloadInstanceInfo* counter_info = engine.find_instance_info("self_counter");
+			auto* counter_ptr = engine.find_instance<DirtyTrackCounterWorkload>("self_counter");
+			REQUIRE(counter_ptr->outputs.value == 3);
+
+			const uint8_t* buffer_begin = engine.get_workloads_buffer().raw_ptr();
+			const auto offset_of = [&](const void* ptr) { return static_cast<size_t>(static_cast<const uint8_t*>(ptr) - buffer_begin); };
+
+			const DirtyRegionTracker& dirty_regions = engine.get_dirty_regions();
+			CHECK(dirty_regions.is_dirty(offset_of(&counter_ptr->outputs.value)));
+			CHECK(dirty_regions.is_dirty(offset_of(&counter_ptr->config.label) + LINE * 2)); // (even its config - anything may change)
+			CHECK(dirty_regions.is_dirty(offset_of(counter_info->workload_stats)));
+
+			// so snapshots copying just the dirty lines keep up with it:
+			WorkloadsBufferSnapshots::Lease snapshot = engine.get_workloads_buffer_snapshots().acquire();
+			REQUIRE(snapshot.is_valid());
+
+			int snapshot_value = 0;
+			::memcpy(&snapshot_value, snapshot.data() + offset_of(&counter_ptr->outputs.value), sizeof(snapshot_value));
+			CHECK(snapshot_value == 3);
+		}
+
+		SECTION("Snapshot dirty-copies need dirty-region tracking")
+		{
+			model.set_dirty_region_tracking_enabled(false);
+			model.set_snapshot_dirty_copy_enabled(true);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "without dirty-region tracking");
+		}
+	}
+
+} // namespace robotick::test
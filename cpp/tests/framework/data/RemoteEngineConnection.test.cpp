@@ -412,6 +412,49 @@ TEST_CASE("Integration/Framework/Data/RemoteEngineConnection")
 		REQUIRE(recv_value == 22);
 	}
 
+	SECTION("Sender sends outputs written between tick_receive() and tick_send() in that same tick", "[RemoteEngineConnection]")
+	{
+		int recv_value = -1;
+		int send_value = 0;
+
+		RemoteEngineConnection receiver;
+		RemoteEngineConnection sender;
+
+		receiver.configure_receiver("test-receiver");
+		receiver.set_field_binder(
+			[&](const char*, RemoteEngineConnection::Field& f)
+			{
+				f.recv_ptr = &recv_value;
+				f.size = sizeof(int);
+				f.path = "x";
+				f.type_desc = TypeRegistry::get().find_by_name("int");
+				return true;
+			});
+
+		const int receiver_listen_port = wait_for_listen_port(receiver);
+		REQUIRE(receiver_listen_port > 0);
+
+		sender.configure_sender("test-sender", "test-receiver", "127.0.0.1", receiver_listen_port);
+		sender.register_field({"x", &send_value, nullptr, sizeof(int), 0});
+
+		// each "tick" writes a fresh output between the two phases, as the engine's workloads would:
+		bool received_same_tick = false;
+		for (int tick = 1; tick <= 200 && !received_same_tick; ++tick)
+		{
+			sender.tick_receive(robotick::TICK_INFO_FIRST_10MS_100HZ);
+			send_value = tick;
+			sender.tick_send();
+
+			Thread::sleep_ms(2);
+			receiver.tick(robotick::TICK_INFO_FIRST_10MS_100HZ);
+
+			// sending in tick_receive() would only ever deliver an earlier tick's value:
+			received_same_tick = (recv_value == tick);
+		}
+
+		CHECK(received_same_tick);
+	}
+
 	SECTION("Two peers exchange data mutually", "[RemoteEngineConnection]")
 	{
 		int a_send = 101, a_recv = 0;
@@ -0,0 +1,201 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/SharedWorkloadsBuffer.h"
+#include "robotick/api.h"
+#include "robotick/config/AssertUtils.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/data/WorkloadsBuffer.h"
+#include "robotick/framework/model/Model.h"
+#include "robotick/framework/system/System.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct SharedBufferValue
+		{
+			int value = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(SharedBufferValue)
+		ROBOTICK_STRUCT_FIELD(SharedBufferValue, int, value)
+		ROBOTICK_REGISTER_STRUCT_END(SharedBufferValue)
+
+		struct SharedBufferCounterWorkload
+		{
+			SharedBufferValue outputs;
+			void tick(const TickInfo&) { outputs.value++; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(SharedBufferCounterWorkload, void, void, SharedBufferValue)
+
+#if defined(__linux__)
+		// the id of a process that has been and gone (reaped, so not reused straight away)
+		int64_t get_exited_process_id()
+		{
+			const pid_t child = ::fork();
+			if (child == 0)
+				::_exit(0);
+
+			int status = 0;
+			::waitpid(child, &status, 0);
+			return static_cast<int64_t>(child);
+		}
+#endif
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Data/SharedWorkloadsBuffer")
+	{
+		SECTION("Readers map the buffer the writer writes, and its layout once published")
+		{
+			RawBuffer buffer(1000, WorkloadsBufferAllocation::SharedMemory, "/robotick_test_shared_raw");
+#if defined(__linux__)
+			REQUIRE(buffer.is_shared());
+#endif
+			if (!buffer.is_shared())
+				return; // (fell back to the heap where there is no shared memory)
+
+			CHECK(reinterpret_cast<uintptr_t>(buffer.raw_ptr()) % DEFAULT_CACHE_LINE_BYTES == 0);
+
+			SharedWorkloadsBufferReader reader;
+			REQUIRE(reader.attach("/robotick_test_shared_raw"));
+			CHECK(reader.get_header()->buffer_size == 1000);
+			CHECK(reader.get_layout_json() == nullptr);
+
+			buffer.raw_ptr()[123] = 42;
+			CHECK(reader.get_buffer()[123] == 42);
+
+			const char layout[] = "{\"workloads\":[]}";
+			REQUIRE(buffer.publish_shared_layout(layout, ::strlen(layout)));
+			REQUIRE(reader.get_layout_json() != nullptr);
+			CHECK(::strcmp(reader.get_layout_json(), layout) == 0);
+
+			// released segments can no longer be attached to (though mapped ones stay readable):
+			buffer = RawBuffer();
+			CHECK(reader.get_buffer()[123] == 42);
+
+			SharedWorkloadsBufferReader late_reader;
+			CHECK_FALSE(late_reader.attach("/robotick_test_shared_raw"));
+		}
+
+		SECTION("Segment names must be POSIX shared-memory names")
+		{
+			ROBOTICK_REQUIRE_ERROR_MSG(RawBuffer(64, WorkloadsBufferAllocation::SharedMemory, "no_leading_slash"), "invalid segment name");
+
+			SharedWorkloadsBufferReader reader;
+			CHECK_FALSE(reader.attach("/robotick_test_shared_missing"));
+		}
+
+#if defined(__linux__)
+		SECTION("Existing segments are only replaced once provably stale")
+		{
+			const char* const segment_name = "/robotick_test_shared_existing";
+			System::unlink_shared_memory(segment_name);
+
+			SECTION("One in use by a running engine")
+			{
+				RawBuffer owner(64, WorkloadsBufferAllocation::SharedMemory, segment_name);
+				REQUIRE(owner.is_shared());
+				ROBOTICK_REQUIRE_ERROR_MSG(RawBuffer(64, WorkloadsBufferAllocation::SharedMemory, segment_name), "in use by a running engine");
+
+				// (and the owner's segment is left as it was)
+				SharedWorkloadsBufferReader reader;
+				CHECK(reader.attach(segment_name));
+			}
+
+			SECTION("One that isn't ours")
+			{
+				size_t mapped_size = 0;
+				bool is_existing = false;
+				void* foreign = System::create_shared_memory(segment_name, 64, mapped_size, is_existing);
+				REQUIRE(foreign != nullptr);
+
+				ROBOTICK_REQUIRE_ERROR_MSG(RawBuffer(64, WorkloadsBufferAllocation::SharedMemory, segment_name), "isn't a stale one of ours");
+
+				System::unmap_shared_memory(foreign, mapped_size);
+				System::unlink_shared_memory(segment_name);
+			}
+
+			SECTION("One left behind by a process that has gone")
+			{
+				size_t mapped_size = 0;
+				bool is_existing = false;
+				void* stale = System::create_shared_memory(segment_name, 4096, mapped_size, is_existing);
+				REQUIRE(stale != nullptr);
+
+				auto* stale_header = new (stale) SharedWorkloadsBufferHeader();
+				stale_header->version = SharedWorkloadsBufferHeader::VERSION;
+				stale_header->owner_process_id = get_exited_process_id();
+				stale_header->buffer_size = 123;
+				stale_header->magic.store(SharedWorkloadsBufferHeader::MAGIC);
+				System::unmap_shared_memory(stale, mapped_size);
+
+				RawBuffer buffer(1000, WorkloadsBufferAllocation::SharedMemory, segment_name);
+				REQUIRE(buffer.is_shared());
+
+				SharedWorkloadsBufferReader reader;
+				REQUIRE(reader.attach(segment_name));
+				CHECK(reader.get_header()->buffer_size == 1000);
+				CHECK(reader.get_header()->owner_process_id == System::get_process_id());
+			}
+		}
+#endif
+	}
+
+	TEST_CASE("Unit/Framework/Data/SharedWorkloadsBuffer/Engine")
+	{
+		static const WorkloadSeed counter{TypeId("SharedBufferCounterWorkload"), StringView("shared_counter"), 100.0f};
+		static const WorkloadSeed* const workloads[] = {&counter};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(counter);
+		model.set_workloads_buffer_allocation(WorkloadsBufferAllocation::SharedMemory);
+		model.set_workloads_buffer_shared_memory_name("/robotick_test_shared_engine");
+
+		Engine engine;
+		engine.load(model);
+
+		if (!engine.get_workloads_buffer().is_shared())
+			return; // (fell back to the heap where there is no shared memory)
+
+		AtomicFlag stop_flag{false};
+		engine.run_virtual_time(stop_flag, 3);
+
+		SharedWorkloadsBufferReader reader;
+		REQUIRE(reader.attach("/robotick_test_shared_engine"));
+		CHECK(reader.get_buffer_size_used() == engine.get_workloads_buffer().get_size_used());
+
+		const char* layout_json = reader.get_layout_json();
+		REQUIRE(layout_json != nullptr);
+		CHECK(::strstr(layout_json, "\"shared_counter\"") != nullptr);
+
+		// frames are read in place, under the same seqlock as telemetry:
+		const auto* counter_ptr = engine.find_instance<SharedBufferCounterWorkload>("shared_counter");
+		const size_t value_offset = reinterpret_cast<const uint8_t*>(&counter_ptr->outputs.value) - engine.get_workloads_buffer().raw_ptr();
+
+		uint32_t frame_seq = 0;
+		REQUIRE(reader.begin_read(frame_seq));
+		CHECK(frame_seq == engine.get_workloads_buffer().get_telemetry_frame_seq());
+
+		int value = 0;
+		::memcpy(&value, reader.get_buffer() + value_offset, sizeof(value));
+		CHECK(reader.end_read(frame_seq));
+		CHECK(value == 3);
+
+		// a frame written since begin_read() invalidates what was read:
+		engine.run_virtual_time(stop_flag, 1);
+		CHECK_FALSE(reader.end_read(frame_seq));
+	}
+
+} // namespace robotick::test
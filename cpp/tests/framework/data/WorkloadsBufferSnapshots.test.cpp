@@ -0,0 +1,145 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/WorkloadsBufferSnapshots.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+
+#include <catch2/catch_all.hpp>
+#include <cstring>
+
+namespace robotick::test
+{
+	namespace
+	{
+		constexpr size_t SNAPSHOT_TEST_BYTES = 4096;
+
+		// writes a frame whose every byte is the frame's number - so any mix of two frames is easy to spot
+		void write_frame(WorkloadsBuffer& buffer, uint8_t frame)
+		{
+			buffer.mark_frame_write_begin();
+			::memset(buffer.raw_ptr(), frame, buffer.get_size_used());
+			buffer.mark_frame_write_end();
+		}
+
+		bool is_whole_frame(const WorkloadsBufferSnapshots::Lease& snapshot)
+		{
+			for (size_t i = 1; i < snapshot.size(); ++i)
+			{
+				if (snapshot.data()[i] != snapshot.data()[0])
+					return false;
+			}
+			return true;
+		}
+
+		struct SnapshotReaderContext
+		{
+			WorkloadsBufferSnapshots* snapshots = nullptr;
+			AtomicFlag stop_flag;
+			AtomicValue<uint32_t> read_count{0};
+			AtomicValue<uint32_t> torn_count{0};
+		};
+
+		void snapshot_reader_entry(void* arg)
+		{
+			SnapshotReaderContext& context = *static_cast<SnapshotReaderContext*>(arg);
+			while (!context.stop_flag.is_set())
+			{
+				WorkloadsBufferSnapshots::Lease snapshot = context.snapshots->acquire();
+				if (!snapshot.is_valid())
+					continue;
+
+				if (!is_whole_frame(snapshot))
+					context.torn_count.fetch_add(1);
+				context.read_count.fetch_add(1);
+			}
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Data/WorkloadsBufferSnapshots")
+	{
+		WorkloadsBuffer buffer(SNAPSHOT_TEST_BYTES);
+		buffer.set_size_used(SNAPSHOT_TEST_BYTES);
+
+		WorkloadsBufferSnapshots snapshots;
+		snapshots.initialize(buffer, 1);
+
+		SECTION("Nothing can be acquired before the first publish")
+		{
+			CHECK_FALSE(snapshots.acquire().is_valid());
+		}
+
+		SECTION("A held snapshot keeps its frame while newer ones are published")
+		{
+			write_frame(buffer, 1);
+			snapshots.publish(buffer);
+
+			WorkloadsBufferSnapshots::Lease first = snapshots.acquire();
+			REQUIRE(first.is_valid());
+			CHECK(first.size() == SNAPSHOT_TEST_BYTES);
+			CHECK(first.get_frame_seq() == buffer.get_telemetry_frame_seq());
+
+			for (uint8_t frame = 2; frame < 10; ++frame)
+			{
+				write_frame(buffer, frame);
+				snapshots.publish(buffer);
+			}
+
+			CHECK(first.data()[0] == 1);
+			CHECK(is_whole_frame(first));
+			CHECK(snapshots.get_published_count() == 9);
+			CHECK(snapshots.get_skipped_publish_count() == 0);
+
+			WorkloadsBufferSnapshots::Lease latest = snapshots.acquire();
+			REQUIRE(latest.is_valid());
+			CHECK(latest.data()[0] == 9);
+		}
+
+		SECTION("Frames are dropped, rather than waited for, once readers pin every spare slot")
+		{
+			// sized for one reader, so holding three leases (on three different frames) leaves the tick nowhere to write:
+			WorkloadsBufferSnapshots::Lease leases[3];
+			for (uint8_t frame = 0; frame < 3; ++frame)
+			{
+				write_frame(buffer, frame);
+				snapshots.publish(buffer);
+				leases[frame] = snapshots.acquire();
+			}
+
+			write_frame(buffer, 3);
+			snapshots.publish(buffer);
+			CHECK(snapshots.get_skipped_publish_count() == 1);
+			CHECK(snapshots.acquire().data()[0] == 2);
+
+			leases[0].release();
+			snapshots.publish(buffer);
+			CHECK(snapshots.get_skipped_publish_count() == 1);
+			CHECK(snapshots.acquire().data()[0] == 3);
+		}
+
+		SECTION("Concurrent readers only ever see whole frames")
+		{
+			SnapshotReaderContext context;
+			context.snapshots = &snapshots;
+			{
+				Thread reader(&snapshot_reader_entry, &context, "SnapshotReader");
+
+				for (uint32_t frame = 0; frame < 2000; ++frame)
+				{
+					write_frame(buffer, static_cast<uint8_t>(frame));
+					snapshots.publish(buffer);
+				}
+
+				while (context.read_count.load() < 100)
+					Thread::sleep_ms(1);
+
+				context.stop_flag.set();
+				reader.join();
+			}
+
+			CHECK(context.torn_count.load() == 0);
+			CHECK(snapshots.get_skipped_publish_count() == 0);
+		}
+	}
+
+} // namespace robotick::test
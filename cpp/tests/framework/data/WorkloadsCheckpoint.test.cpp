@@ -0,0 +1,290 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/data/WorkloadsCheckpoint.h"
+#include "../utils/TelemetryTestUtils.h"
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/data/Blackboard.h"
+#include "robotick/framework/model/Model.h"
+
+#include <catch2/catch_all.hpp>
+#include <cstdio>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct CheckpointGroupWorkload
+		{
+		};
+		ROBOTICK_REGISTER_WORKLOAD(CheckpointGroupWorkload)
+
+		struct CheckpointPairOutputs
+		{
+			int first = 0;
+			int second = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(CheckpointPairOutputs)
+		ROBOTICK_STRUCT_FIELD(CheckpointPairOutputs, int, first)
+		ROBOTICK_STRUCT_FIELD(CheckpointPairOutputs, int, second)
+		ROBOTICK_REGISTER_STRUCT_END(CheckpointPairOutputs)
+
+		// outputs are checkpointed, but not private members (unless the workload is checkpointable)
+		struct CheckpointCounterWorkload
+		{
+			CheckpointPairOutputs outputs;
+			int ticks_since_load = 0;
+
+			void tick(const TickInfo&)
+			{
+				outputs.first++;
+				outputs.second++;
+				ticks_since_load++;
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(CheckpointCounterWorkload, void, void, CheckpointPairOutputs)
+
+		struct CheckpointIntegratorOutputs
+		{
+			double integral = 0.0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(CheckpointIntegratorOutputs)
+		ROBOTICK_STRUCT_FIELD(CheckpointIntegratorOutputs, double, integral)
+		ROBOTICK_REGISTER_STRUCT_END(CheckpointIntegratorOutputs)
+
+		struct CheckpointIntegratorWorkload
+		{
+			static constexpr bool is_checkpointable = true;
+
+			CheckpointIntegratorOutputs outputs;
+			double previous_step = 0.0;
+
+			void tick(const TickInfo&)
+			{
+				previous_step += 0.5;
+				outputs.integral += previous_step;
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(CheckpointIntegratorWorkload, void, void, CheckpointIntegratorOutputs)
+
+		struct CheckpointBlackboardOutputs
+		{
+			Blackboard samples;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(CheckpointBlackboardOutputs)
+		ROBOTICK_STRUCT_FIELD(CheckpointBlackboardOutputs, Blackboard, samples)
+		ROBOTICK_REGISTER_STRUCT_END(CheckpointBlackboardOutputs)
+
+		struct CheckpointBlackboardState
+		{
+			HeapVector<FieldDescriptor> fields;
+		};
+
+		// (as a script would declare it - so engines loading the same model can still differ in their blackboard's fields)
+		const char* checkpoint_blackboard_field_name = "count";
+
+		struct CheckpointBlackboardWorkload
+		{
+			static constexpr bool is_relocatable = true; // (its State<> only points at the heap)
+
+			CheckpointBlackboardOutputs outputs;
+			State<CheckpointBlackboardState> state;
+
+			void pre_load()
+			{
+				state->fields.initialize(1);
+				state->fields[0] = FieldDescriptor{checkpoint_blackboard_field_name, GET_TYPE_ID(int)};
+				outputs.samples.initialize_fields(state->fields);
+			}
+
+			void tick(const TickInfo&)
+			{
+				const char* name = checkpoint_blackboard_field_name;
+				outputs.samples.set<int>(name, outputs.samples.get<int>(name) + 1);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(CheckpointBlackboardWorkload, void, void, CheckpointBlackboardOutputs)
+
+		struct CheckpointTestModel
+		{
+			Model model;
+
+			explicit CheckpointTestModel(bool with_blackboard)
+			{
+				static const WorkloadSeed counter{TypeId("CheckpointCounterWorkload"), StringView("counter"), 100.0f};
+				static const WorkloadSeed integrator{TypeId("CheckpointIntegratorWorkload"), StringView("integrator"), 100.0f};
+				static const WorkloadSeed samples{TypeId("CheckpointBlackboardWorkload"), StringView("samples"), 100.0f};
+
+				static const WorkloadSeed* const full_children[] = {&counter, &integrator, &samples};
+				static const WorkloadSeed full_root{TypeId("CheckpointGroupWorkload"), StringView("root"), 100.0f, full_children};
+				static const WorkloadSeed* const full_workloads[] = {&counter, &integrator, &samples, &full_root};
+
+				static const WorkloadSeed* const reduced_children[] = {&counter, &integrator};
+				static const WorkloadSeed reduced_root{TypeId("CheckpointGroupWorkload"), StringView("root"), 100.0f, reduced_children};
+				static const WorkloadSeed* const reduced_workloads[] = {&counter, &integrator, &reduced_root};
+
+				model.set_telemetry_port(choose_telemetry_port());
+				if (with_blackboard)
+				{
+					model.use_workload_seeds(full_workloads);
+					model.set_root_workload(full_root);
+				}
+				else
+				{
+					model.use_workload_seeds(reduced_workloads);
+					model.set_root_workload(reduced_root);
+				}
+			}
+		};
+
+		struct EngineRunContext
+		{
+			Engine* engine = nullptr;
+			AtomicFlag* stop_flag = nullptr;
+		};
+
+		void run_engine_entry(void* user_data)
+		{
+			auto* context = static_cast<EngineRunContext*>(user_data);
+			context->engine->run(*context->stop_flag);
+		}
+
+		const char* const CHECKPOINT_PATH = "robotick_test_checkpoint.bin";
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Data/WorkloadsCheckpoint")
+	{
+		::remove(CHECKPOINT_PATH);
+
+		SECTION("A fresh engine resumes from the saved frame")
+		{
+			CheckpointTestModel source_model(true);
+			Engine source;
+			source.load(source_model.model);
+
+			AtomicFlag stop_flag{false};
+			source.run_virtual_time(stop_flag, 5);
+			REQUIRE(source.save_checkpoint(CHECKPOINT_PATH));
+
+			CheckpointTestModel restored_model(true);
+			Engine restored;
+			restored.load(restored_model.model);
+			REQUIRE(restored.restore_checkpoint(CHECKPOINT_PATH));
+
+			const auto* counter = restored.find_instance<CheckpointCounterWorkload>("counter");
+			CHECK(counter->outputs.first == 5);
+			CHECK(counter->outputs.second == 5);
+			CHECK(counter->ticks_since_load == 0); // (a private member of a workload that isn't checkpointable)
+
+			const auto* integrator = restored.find_instance<CheckpointIntegratorWorkload>("integrator");
+			CHECK(integrator->previous_step == Catch::Approx(2.5));
+			CHECK(integrator->outputs.integral == Catch::Approx(7.5));
+
+			const auto* samples = restored.find_instance<CheckpointBlackboardWorkload>("samples");
+			CHECK(samples->outputs.samples.get<int>("count") == 5);
+
+			// and carries on from there:
+			restored.run_virtual_time(stop_flag, 1);
+			CHECK(counter->outputs.first == 6);
+			CHECK(integrator->outputs.integral == Catch::Approx(10.5));
+			CHECK(samples->outputs.samples.get<int>("count") == 6);
+		}
+
+		SECTION("Checkpoints that are missing or from another layout restore nothing")
+		{
+			CheckpointTestModel restored_model(true);
+			Engine restored;
+			restored.load(restored_model.model);
+			CHECK_FALSE(restored.restore_checkpoint(CHECKPOINT_PATH));
+
+			CheckpointTestModel other_model(false);
+			Engine other;
+			other.load(other_model.model);
+
+			AtomicFlag stop_flag{false};
+			other.run_virtual_time(stop_flag, 3);
+			REQUIRE(other.save_checkpoint(CHECKPOINT_PATH));
+
+			CHECK_FALSE(restored.restore_checkpoint(CHECKPOINT_PATH));
+			CHECK(restored.find_instance<CheckpointCounterWorkload>("counter")->outputs.first == 0);
+		}
+
+		SECTION("Checkpoints whose fields differ only in name restore nothing")
+		{
+			CheckpointTestModel source_model(true);
+			Engine source;
+			source.load(source_model.model);
+
+			AtomicFlag stop_flag{false};
+			source.run_virtual_time(stop_flag, 2);
+			REQUIRE(source.save_checkpoint(CHECKPOINT_PATH));
+
+			// (the same offsets and sizes throughout - only the blackboard's field is named differently)
+			checkpoint_blackboard_field_name = "total";
+			CheckpointTestModel restored_model(true);
+			Engine restored;
+			restored.load(restored_model.model);
+			checkpoint_blackboard_field_name = "count";
+
+			CHECK(restored.get_workloads_buffer().get_size() == source.get_workloads_buffer().get_size());
+			CHECK_FALSE(restored.restore_checkpoint(CHECKPOINT_PATH));
+		}
+
+		SECTION("Damaged checkpoints restore nothing")
+		{
+			CheckpointTestModel source_model(true);
+			Engine source;
+			source.load(source_model.model);
+
+			AtomicFlag stop_flag{false};
+			source.run_virtual_time(stop_flag, 2);
+			REQUIRE(source.save_checkpoint(CHECKPOINT_PATH));
+
+			FILE* file = ::fopen(CHECKPOINT_PATH, "r+b");
+			REQUIRE(file != nullptr);
+			::fseek(file, -1, SEEK_END);
+			const int last_byte = ::fgetc(file);
+			::fseek(file, -1, SEEK_END);
+			::fputc(last_byte ^ 0x5A, file);
+			::fclose(file);
+
+			CheckpointTestModel restored_model(true);
+			Engine restored;
+			restored.load(restored_model.model);
+			CHECK_FALSE(restored.restore_checkpoint(CHECKPOINT_PATH));
+		}
+
+		SECTION("Saving while running captures one whole frame")
+		{
+			CheckpointTestModel source_model(true);
+			Engine source;
+			source.load(source_model.model);
+
+			AtomicFlag stop_flag{false};
+			EngineRunContext context{&source, &stop_flag};
+			Thread runner(&run_engine_entry, &context, "CheckpointRunner");
+
+			Thread::sleep_ms(50);
+			const bool is_saved = source.save_checkpoint(CHECKPOINT_PATH);
+			stop_flag.set();
+			runner.join();
+			REQUIRE(is_saved);
+
+			CheckpointTestModel restored_model(true);
+			Engine restored;
+			restored.load(restored_model.model);
+			REQUIRE(restored.restore_checkpoint(CHECKPOINT_PATH));
+
+			const auto* counter = restored.find_instance<CheckpointCounterWorkload>("counter");
+			CHECK(counter->outputs.first > 0);
+			CHECK(counter->outputs.first == counter->outputs.second);
+			CHECK(restored.find_instance<CheckpointBlackboardWorkload>("samples")->outputs.samples.get<int>("count") == counter->outputs.first);
+		}
+
+		::remove(CHECKPOINT_PATH);
+	}
+
+} // namespace robotick::test
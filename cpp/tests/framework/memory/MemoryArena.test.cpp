@@ -0,0 +1,196 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/memory/MemoryArena.h"
+#include "robotick/api.h"
+#include "robotick/config/AssertUtils.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/containers/HeapVector.h"
+#include "robotick/framework/containers/List.h"
+#include "robotick/framework/data/State.h"
+#include "robotick/framework/model/Model.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct ArenaLargeState
+		{
+			uint8_t samples[8 * 1024] = {};
+		};
+
+		struct ArenaWorkloadState
+		{
+			HeapVector<float> history;
+			List<int> events;
+			HeapVector<float> late_history; // (initialized on first tick, once the arena is sealed)
+		};
+
+		struct ArenaStateWorkload
+		{
+			StatePtr<ArenaLargeState> large_state;
+			State<ArenaWorkloadState> state;
+
+			void load()
+			{
+				state->history.initialize(256);
+				state->events.push_back(1);
+			}
+
+			void tick(const TickInfo&)
+			{
+				if (state->late_history.empty())
+					state->late_history.initialize(16);
+				state->events.push_back(2);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(ArenaStateWorkload)
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Memory/MemoryArena")
+	{
+		SECTION("Allocations are aligned, packed into chunks, and oversized ones get a chunk of their own")
+		{
+			MemoryArena arena(1024);
+			CHECK(arena.get_chunk_count() == 0);
+
+			void* first = arena.allocate(10, 1);
+			void* second = arena.allocate(8, 8);
+			void* over_aligned = arena.allocate(32, 64);
+			CHECK(reinterpret_cast<uintptr_t>(second) % 8 == 0);
+			CHECK(reinterpret_cast<uintptr_t>(over_aligned) % 64 == 0);
+			CHECK(static_cast<uint8_t*>(second) - static_cast<uint8_t*>(first) == 16);
+			CHECK(arena.get_chunk_count() == 1);
+			CHECK(arena.get_bytes_used() == 50);
+
+			void* oversized = arena.allocate(4096, 16);
+			CHECK(arena.get_chunk_count() == 2);
+			CHECK(arena.get_bytes_reserved() == 1024 + 4096);
+
+			// (and the first chunk's remaining space is still used)
+			void* after_oversized = arena.allocate(8, 8);
+			CHECK(arena.get_chunk_count() == 2);
+			CHECK(static_cast<uint8_t*>(after_oversized) - static_cast<uint8_t*>(over_aligned) == 32);
+
+			CHECK(arena.owns(first));
+			CHECK(arena.owns(static_cast<uint8_t*>(oversized) + 4095));
+
+			int on_heap = 0;
+			CHECK_FALSE(arena.owns(&on_heap));
+
+			arena.allocate(2000, 8);
+			CHECK(arena.get_chunk_count() == 3);
+		}
+
+		SECTION("Sealed arenas refuse allocations")
+		{
+			MemoryArena arena(1024);
+			arena.allocate(16, 8);
+			arena.seal();
+			CHECK(arena.is_sealed());
+			ROBOTICK_REQUIRE_ERROR_MSG(arena.allocate(16, 8), "after the arena was sealed");
+		}
+
+		SECTION("Containers allocate from the current arena, and the heap otherwise")
+		{
+			MemoryArena arena(64 * 1024);
+
+			HeapVector<int> heap_vector;
+			heap_vector.initialize(4);
+			CHECK_FALSE(arena.owns(heap_vector.data()));
+
+			HeapVector<int> arena_vector;
+			List<int> list;
+			{
+				ScopedMemoryArena scope(&arena);
+				CHECK(MemoryArena::get_current() == &arena);
+
+				arena_vector.initialize(4);
+				list.push_back(1);
+
+				StatePtr<ArenaLargeState> large_state;
+				CHECK(arena.owns(&large_state.get()));
+
+				{
+					ScopedMemoryArena heap_scope(nullptr);
+					HeapVector<int> scratch;
+					scratch.initialize(4);
+					CHECK_FALSE(arena.owns(scratch.data()));
+				}
+				CHECK(MemoryArena::get_current() == &arena);
+			}
+			CHECK(MemoryArena::get_current() == nullptr);
+			CHECK(arena.owns(arena_vector.data()));
+
+			// nodes pushed afterwards come from the heap - and each is freed from wherever it came from:
+			list.push_back(2);
+			int expected = 1;
+			for (int& value : list)
+			{
+				CHECK(value == expected);
+				CHECK(arena.owns(&value) == (expected == 1));
+				expected++;
+			}
+
+			// moves carry where the memory came from with it:
+			HeapVector<int> moved_vector(robotick::move(arena_vector));
+			CHECK(arena.owns(moved_vector.data()));
+
+			// sealed arenas are passed over:
+			arena.seal();
+			ScopedMemoryArena scope(&arena);
+			HeapVector<int> after_seal;
+			after_seal.initialize(4);
+			CHECK_FALSE(arena.owns(after_seal.data()));
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Memory/MemoryArena/Engine")
+	{
+		static const WorkloadSeed workload{TypeId("ArenaStateWorkload"), StringView("arena_state"), 100.0f};
+		static const WorkloadSeed* const workloads[] = {&workload};
+
+		SECTION("Loading allocates workload state from the engine's arena, sealing it afterwards")
+		{
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(workload);
+			model.set_state_arena_enabled(true);
+
+			Engine engine;
+			engine.load(model);
+
+			const MemoryArena& arena = engine.get_state_arena();
+			CHECK(arena.is_sealed());
+			CHECK(arena.get_bytes_used() >= sizeof(ArenaLargeState) + 256 * sizeof(float));
+
+			auto* instance = engine.find_instance<ArenaStateWorkload>("arena_state");
+			CHECK(arena.owns(&instance->large_state.get()));
+			CHECK(arena.owns(instance->state->history.data()));
+			CHECK(arena.owns(&*instance->state->events.begin()));
+
+			AtomicFlag stop_flag{false};
+			engine.run_virtual_time(stop_flag, 2);
+			CHECK_FALSE(arena.owns(instance->state->late_history.data()));
+			CHECK(instance->state->events.size() == 3);
+		}
+
+		SECTION("Without it, loading allocates from the heap")
+		{
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(workload);
+
+			Engine engine;
+			engine.load(model);
+
+			const MemoryArena& arena = engine.get_state_arena();
+			CHECK(arena.get_chunk_count() == 0);
+			CHECK_FALSE(arena.owns(&engine.find_instance<ArenaStateWorkload>("arena_state")->large_state.get()));
+		}
+	}
+
+} // namespace robotick::test
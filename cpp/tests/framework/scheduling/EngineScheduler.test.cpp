@@ -0,0 +1,123 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/EngineScheduler.h"
+#include "robotick/config/AssertUtils.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/model/Model.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	// counts its ticks, stopping the scheduler once it has ticked ticks_to_run times (0 = never), and notes whether any tick ran
+	// ahead of its slot on the engine's own schedule (the Nth tick is due N tick-intervals after the run's time origin)
+	struct SchedulerTickCountWorkload
+	{
+		static AtomicFlag stop_flag;
+
+		uint64_t ticks_to_run = 0;
+		uint64_t tick_count = 0;
+		uint64_t last_time_now_ns = 0;
+		bool has_ticked_early = false;
+		Thread::ThreadId tick_thread{};
+
+		void tick(const TickInfo& tick_info)
+		{
+			tick_count++;
+			last_time_now_ns = tick_info.time_now_ns;
+			tick_thread = Thread::get_current_thread_id();
+
+			const uint64_t interval_ns = Clock::to_nanoseconds(Clock::from_seconds(1.0f / tick_info.tick_rate_hz)).count();
+			has_ticked_early = has_ticked_early || tick_info.time_now_ns < tick_count * interval_ns;
+
+			if (ticks_to_run > 0 && tick_count >= ticks_to_run)
+				stop_flag.set();
+		}
+	};
+	AtomicFlag SchedulerTickCountWorkload::stop_flag;
+
+	ROBOTICK_REGISTER_WORKLOAD(SchedulerTickCountWorkload)
+
+	TEST_CASE("Unit/Framework/Scheduling/EngineScheduler")
+	{
+		static const WorkloadSeed fast_seed{TypeId("SchedulerTickCountWorkload"), StringView("scheduler_fast"), 200.0f};
+		static const WorkloadSeed slow_seed{TypeId("SchedulerTickCountWorkload"), StringView("scheduler_slow"), 50.0f};
+		static const WorkloadSeed* const fast_workloads[] = {&fast_seed};
+		static const WorkloadSeed* const slow_workloads[] = {&slow_seed};
+
+		// one model per engine, each with its own telemetry port:
+		Model fast_model;
+		fast_model.set_telemetry_port(choose_telemetry_port());
+		fast_model.use_workload_seeds(fast_workloads);
+		fast_model.set_root_workload(fast_seed);
+
+		Model slow_model;
+		slow_model.set_telemetry_port(choose_telemetry_port());
+		slow_model.use_workload_seeds(slow_workloads);
+		slow_model.set_root_workload(slow_seed);
+
+		Engine fast_engine;
+		Engine slow_engine;
+		fast_engine.load(fast_model);
+		slow_engine.load(slow_model);
+
+		auto* fast = fast_engine.find_instance<SchedulerTickCountWorkload>("scheduler_fast");
+		auto* slow = slow_engine.find_instance<SchedulerTickCountWorkload>("scheduler_slow");
+		REQUIRE(fast != nullptr);
+		REQUIRE(slow != nullptr);
+		slow->ticks_to_run = 6;
+
+		EngineScheduler scheduler;
+		scheduler.add_engine(fast_engine);
+		scheduler.add_engine(slow_engine);
+		CHECK(scheduler.get_engine_count() == 2);
+
+		SECTION("Engines tick at their own rates from the calling thread")
+		{
+			SchedulerTickCountWorkload::stop_flag.clear();
+			scheduler.run(SchedulerTickCountWorkload::stop_flag);
+
+			// each engine keeps to its own schedule - no tick before its slot - and the fast one's slots come 4x as often, so
+			// however the machine delays us, it has had at least as many ticks fall due (and catches up on every one):
+			CHECK(slow->tick_count == 6);
+			CHECK(slow->last_time_now_ns >= 6 * 20000000ull);
+			CHECK_FALSE(slow->has_ticked_early);
+			CHECK_FALSE(fast->has_ticked_early);
+			CHECK(fast->tick_count >= slow->tick_count);
+
+			CHECK(fast->tick_thread == Thread::get_current_thread_id());
+			CHECK(slow->tick_thread == Thread::get_current_thread_id());
+
+			CHECK_FALSE(fast_engine.is_running());
+			CHECK_FALSE(slow_engine.is_running());
+		}
+
+		SECTION("Engines falling due together can tick on a shared worker pool")
+		{
+			scheduler.set_worker_thread_count(2);
+
+			SchedulerTickCountWorkload::stop_flag.clear();
+			scheduler.run(SchedulerTickCountWorkload::stop_flag);
+
+			CHECK(slow->tick_count == 6);
+			CHECK_FALSE(slow->has_ticked_early);
+			CHECK_FALSE(fast->has_ticked_early);
+			CHECK(fast->tick_count >= slow->tick_count);
+			CHECK(fast_engine.get_tick_plan().get_worker_pool() != nullptr);
+		}
+
+		SECTION("Engines can only be added once, and only once loaded")
+		{
+			ROBOTICK_REQUIRE_ERROR_MSG(scheduler.add_engine(fast_engine), "was already added");
+
+			Engine unloaded_engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(scheduler.add_engine(unloaded_engine), "must be loaded");
+		}
+	}
+
+} // namespace robotick::test
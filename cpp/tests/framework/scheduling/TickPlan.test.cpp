@@ -0,0 +1,1131 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "robotick/api.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/WorkloadInstanceInfo.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/concurrency/Thread.h"
+#include "robotick/framework/data/DataConnection.h"
+#include "robotick/framework/model/Model.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+#include <sched.h>
+
+namespace robotick::test
+{
+	namespace
+	{
+		struct TickPlanContainerWorkload
+		{
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanContainerWorkload)
+
+		struct TickPlanProducerOutputs
+		{
+			int value = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(TickPlanProducerOutputs)
+		ROBOTICK_STRUCT_FIELD(TickPlanProducerOutputs, int, value)
+		ROBOTICK_REGISTER_STRUCT_END(TickPlanProducerOutputs)
+
+		struct TickPlanProducerWorkload
+		{
+			TickPlanProducerOutputs outputs;
+			void tick(const TickInfo&) { outputs.value++; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanProducerWorkload, void, void, TickPlanProducerOutputs)
+
+		struct TickPlanConsumerInputs
+		{
+			int value = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(TickPlanConsumerInputs)
+		ROBOTICK_STRUCT_FIELD(TickPlanConsumerInputs, int, value)
+		ROBOTICK_REGISTER_STRUCT_END(TickPlanConsumerInputs)
+
+		struct TickPlanConsumerWorkload
+		{
+			TickPlanConsumerInputs inputs;
+			int last_seen_value = 0;
+			int tick_count = 0;
+			float last_delta_time = 0.0f;
+
+			void tick(const TickInfo& tick_info)
+			{
+				last_seen_value = inputs.value;
+				last_delta_time = tick_info.delta_time;
+				tick_count++;
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanConsumerWorkload, void, TickPlanConsumerInputs)
+
+		// stand-in for a synced group: ticks its children concurrently via the engine's worker pool
+		struct TickPlanSyncedGroupWorkload
+		{
+			const Engine* engine = nullptr;
+			uint32_t tick_plan_index = 0;
+
+			void set_engine(const Engine& in_engine) { engine = &in_engine; }
+
+			void setup() { tick_plan_index = engine->get_tick_plan().find_entry_index(*engine->find_instance_info("synced")); }
+
+			void tick(const TickInfo& tick_info) { engine->get_tick_plan().tick_children_parallel(tick_plan_index, tick_info); }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanSyncedGroupWorkload)
+
+		// observes concurrency directly rather than inferring it from timing: each tick holds on (for up to a second) until the
+		// expected number of ticks have arrived, noting the most that were ever in flight together
+		struct TickPlanOverlapProbe
+		{
+			AtomicValue<int> arrived{0};
+			AtomicValue<int> in_flight{0};
+			AtomicValue<int> peak_in_flight{0};
+			int expected = 1;
+
+			void reset(int in_expected)
+			{
+				arrived.store(0);
+				in_flight.store(0);
+				peak_in_flight.store(0);
+				expected = in_expected;
+			}
+
+			void tick()
+			{
+				const int now_in_flight = in_flight.fetch_add(1) + 1;
+				int peak = peak_in_flight.load();
+				while (now_in_flight > peak && !peak_in_flight.compare_exchange_weak(peak, now_in_flight))
+				{
+				}
+
+				arrived.fetch_add(1);
+				for (int waited_ms = 0; arrived.load() < expected && waited_ms < 1000; ++waited_ms)
+					Thread::sleep_ms(1);
+
+				in_flight.fetch_sub(1);
+			}
+		};
+
+		TickPlanOverlapProbe sleepy_overlap_probe;
+
+		struct TickPlanSleepyWorkload
+		{
+			AtomicValue<int> tick_count{0};
+			Thread::ThreadId tick_thread = 0;
+
+			void tick(const TickInfo&)
+			{
+				tick_thread = Thread::get_current_thread_id();
+				sleepy_overlap_probe.tick();
+				tick_count.fetch_add(1);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanSleepyWorkload)
+
+		struct TickPlanRelayWorkload
+		{
+			TickPlanConsumerInputs inputs;
+			TickPlanProducerOutputs outputs;
+			void tick(const TickInfo&) { outputs.value = inputs.value + 1; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanRelayWorkload, void, TickPlanConsumerInputs, TickPlanProducerOutputs)
+
+		// publishes whatever the test last asked it to, so its consumers only see a change when the test makes one
+		struct TickPlanLatchProducerWorkload
+		{
+			TickPlanProducerOutputs outputs;
+			int next_value = 0;
+			void tick(const TickInfo&) { outputs.value = next_value; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanLatchProducerWorkload, void, void, TickPlanProducerOutputs)
+
+		struct TickPlanEventConsumerWorkload
+		{
+			static constexpr bool is_event_driven = true;
+
+			TickPlanConsumerInputs inputs;
+			int last_seen_value = 0;
+			int tick_count = 0;
+
+			void tick(const TickInfo&)
+			{
+				last_seen_value = inputs.value;
+				tick_count++;
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanEventConsumerWorkload, void, TickPlanConsumerInputs)
+
+		TickPlanOverlapProbe thread_overlap_probe;
+
+		// remembers which thread (and CPU) started and ticked it
+		struct TickPlanThreadProbeWorkload
+		{
+			AtomicValue<int> tick_count{0};
+			Thread::ThreadId start_thread = 0;
+			Thread::ThreadId tick_thread = 0;
+			int tick_cpu = -1;
+
+			void start(float) { start_thread = Thread::get_current_thread_id(); }
+
+			void tick(const TickInfo&)
+			{
+				tick_thread = Thread::get_current_thread_id();
+				tick_cpu = ::sched_getcpu();
+				thread_overlap_probe.tick();
+				tick_count.fetch_add(1);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanThreadProbeWorkload)
+
+		struct TickPlanJointConfig
+		{
+			int gain = 1;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(TickPlanJointConfig)
+		ROBOTICK_STRUCT_FIELD(TickPlanJointConfig, int, gain)
+		ROBOTICK_REGISTER_STRUCT_END(TickPlanJointConfig)
+
+		// instanced: every element is ticked by one tick_batch() call
+		struct TickPlanJointWorkload
+		{
+			static int batch_call_count;
+			static size_t last_batch_size;
+
+			TickPlanJointConfig config;
+			TickPlanConsumerInputs inputs;
+			TickPlanProducerOutputs outputs;
+
+			static void tick_batch(const TickInfo&, ArrayView<TickPlanJointWorkload> joints)
+			{
+				batch_call_count++;
+				last_batch_size = joints.size();
+				for (TickPlanJointWorkload& joint : joints)
+					joint.outputs.value = joint.inputs.value * joint.config.gain;
+			}
+		};
+		int TickPlanJointWorkload::batch_call_count = 0;
+		size_t TickPlanJointWorkload::last_batch_size = 0;
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanJointWorkload, TickPlanJointConfig, TickPlanConsumerInputs, TickPlanProducerOutputs)
+
+		struct TickPlanModeOutputs
+		{
+			bool nav_enabled = true;
+			int speed = 0;
+		};
+		ROBOTICK_REGISTER_STRUCT_BEGIN(TickPlanModeOutputs)
+		ROBOTICK_STRUCT_FIELD(TickPlanModeOutputs, bool, nav_enabled)
+		ROBOTICK_STRUCT_FIELD(TickPlanModeOutputs, int, speed)
+		ROBOTICK_REGISTER_STRUCT_END(TickPlanModeOutputs)
+
+		// publishes which parts of the model should run
+		struct TickPlanModeWorkload
+		{
+			TickPlanModeOutputs outputs;
+			void tick(const TickInfo&) {}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanModeWorkload, void, void, TickPlanModeOutputs)
+
+		// only wants ticking while it has something queued
+		struct TickPlanIdleWorkload
+		{
+			bool has_queued_work = false;
+			int tick_count = 0;
+
+			bool has_work() const { return has_queued_work; }
+			void tick(const TickInfo&) { tick_count++; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanIdleWorkload)
+
+		// a container that never has work - so neither it nor anything beneath it ever ticks
+		struct TickPlanIdleGroupWorkload
+		{
+			bool has_work() const { return false; }
+		};
+		ROBOTICK_REGISTER_WORKLOAD(TickPlanIdleGroupWorkload)
+
+		TickInfo make_root_tick_info(uint64_t tick_count, float tick_rate_hz)
+		{
+			const uint64_t period_ns = static_cast<uint64_t>(1e9 / tick_rate_hz);
+
+			TickInfo tick_info;
+			tick_info.tick_count = tick_count;
+			tick_info.tick_rate_hz = tick_rate_hz;
+			tick_info.time_now_ns = tick_count * period_ns;
+			tick_info.time_now = tick_info.time_now_ns * 1e-9f;
+			tick_info.delta_time = period_ns * 1e-9f;
+			return tick_info;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan")
+	{
+		static const WorkloadSeed producer{TypeId("TickPlanProducerWorkload"), StringView("producer"), 100.0f};
+		static const WorkloadSeed consumer{TypeId("TickPlanConsumerWorkload"), StringView("consumer"), 100.0f};
+		static const WorkloadSeed slow_consumer{TypeId("TickPlanConsumerWorkload"), StringView("slow_consumer"), 25.0f};
+
+		static const WorkloadSeed* const inner_children[] = {&consumer, &slow_consumer};
+		static const WorkloadSeed inner{TypeId("TickPlanContainerWorkload"), StringView("inner"), 100.0f, inner_children};
+
+		static const WorkloadSeed* const root_children[] = {&producer, &inner};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("root"), 100.0f, root_children};
+
+		static const WorkloadSeed* const workloads[] = {&producer, &consumer, &slow_consumer, &inner, &root};
+
+		static const DataConnectionSeed to_consumer("producer.outputs.value", "consumer.inputs.value");
+		static const DataConnectionSeed to_slow_consumer("producer.outputs.value", "slow_consumer.inputs.value");
+		static const DataConnectionSeed* const connections[] = {&to_consumer, &to_slow_consumer};
+
+		Model model;
+		model.use_workload_seeds(workloads);
+		model.use_data_connection_seeds(connections);
+		model.set_root_workload(root);
+
+		Engine engine;
+		engine.load(model);
+
+		TickPlan& tick_plan = engine.get_tick_plan();
+
+		SECTION("Entries are flattened in pre-order with contiguous subtrees")
+		{
+			const auto& entries = tick_plan.get_entries();
+			REQUIRE(entries.size() == 5);
+
+			CHECK(entries[0].instance_info == engine.find_instance_info("root"));
+			CHECK(entries[1].instance_info == engine.find_instance_info("producer"));
+			CHECK(entries[2].instance_info == engine.find_instance_info("inner"));
+			CHECK(entries[3].instance_info == engine.find_instance_info("consumer"));
+			CHECK(entries[4].instance_info == engine.find_instance_info("slow_consumer"));
+
+			CHECK(entries[0].subtree_end == 5);
+			CHECK(entries[1].subtree_end == 2);
+			CHECK(entries[2].subtree_end == 5);
+			CHECK(entries[3].parent_index == 2);
+
+			CHECK(entries[0].is_engine_sequenced());
+			CHECK_FALSE(entries[1].is_engine_sequenced());
+
+			CHECK(entries[3].tick_rate_divisor == 1);
+			CHECK(entries[4].tick_rate_divisor == 4);
+
+			CHECK(tick_plan.find_entry_index(*engine.find_instance_info("slow_consumer")) == 4);
+		}
+
+		SECTION("Connections are claimed and attached to their consumer")
+		{
+			for (const DataConnectionInfo& conn : engine.get_all_data_connections())
+			{
+				CHECK(conn.expected_handler == DataConnectionInfo::ExpectedHandler::Engine);
+			}
+
+			const auto& entries = tick_plan.get_entries();
+			CHECK(entries[1].connections_count == 0);
+			REQUIRE(entries[3].connections_count == 1);
+			REQUIRE(entries[4].connections_count == 1);
+			CHECK(tick_plan.get_connections()[entries[3].connections_begin]->dest_workload == engine.find_instance_info("consumer"));
+		}
+
+		SECTION("Children tick in order at their divided rates")
+		{
+			tick_plan.start();
+
+			for (uint64_t tick = 1; tick <= 8; ++tick)
+			{
+				tick_plan.tick_root(make_root_tick_info(tick, 100.0f));
+			}
+
+			const auto* producer_ptr = engine.find_instance<TickPlanProducerWorkload>("producer");
+			const auto* consumer_ptr = engine.find_instance<TickPlanConsumerWorkload>("consumer");
+			const auto* slow_consumer_ptr = engine.find_instance<TickPlanConsumerWorkload>("slow_consumer");
+
+			CHECK(producer_ptr->outputs.value == 8);
+
+			// the consumer ticks after the producer each tick, so sees this tick's value:
+			CHECK(consumer_ptr->tick_count == 8);
+			CHECK(consumer_ptr->last_seen_value == 8);
+
+			// the slow consumer ticks on root ticks 1 and 5:
+			CHECK(slow_consumer_ptr->tick_count == 2);
+			CHECK(slow_consumer_ptr->last_seen_value == 5);
+			CHECK(slow_consumer_ptr->last_delta_time == Catch::Approx(0.04f));
+
+			CHECK(engine.find_instance_info("slow_consumer")->workload_stats->tick_count == 2);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/Parallel")
+	{
+		static const WorkloadSeed sleepy_a{TypeId("TickPlanSleepyWorkload"), StringView("sleepy_a"), 50.0f};
+		static const WorkloadSeed sleepy_b{TypeId("TickPlanSleepyWorkload"), StringView("sleepy_b"), 50.0f};
+		static const WorkloadSeed sleepy_c{TypeId("TickPlanSleepyWorkload"), StringView("sleepy_c"), 50.0f};
+		static const WorkloadSeed* const synced_children[] = {&sleepy_a, &sleepy_b, &sleepy_c};
+		static const WorkloadSeed synced{TypeId("TickPlanSyncedGroupWorkload"), StringView("synced"), 50.0f, synced_children};
+		static const WorkloadSeed* const workloads[] = {&sleepy_a, &sleepy_b, &sleepy_c, &synced};
+
+		SECTION("Children of a synced group run concurrently and finish before the group's tick returns")
+		{
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(synced);
+			model.set_worker_thread_count(3);
+
+			Engine engine;
+			engine.load(model);
+			REQUIRE(engine.get_worker_pool() != nullptr);
+
+			const auto* a = engine.find_instance<TickPlanSleepyWorkload>("sleepy_a");
+			const auto* b = engine.find_instance<TickPlanSleepyWorkload>("sleepy_b");
+			const auto* c = engine.find_instance<TickPlanSleepyWorkload>("sleepy_c");
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			tick_plan.start();
+
+			sleepy_overlap_probe.reset(3);
+			tick_plan.tick_root(make_root_tick_info(1, 50.0f));
+
+			CHECK(a->tick_count.load() == 1);
+			CHECK(b->tick_count.load() == 1);
+			CHECK(c->tick_count.load() == 1);
+
+			// all three were ticking at once:
+			CHECK(sleepy_overlap_probe.peak_in_flight.load() == 3);
+
+			const bool used_several_threads = (a->tick_thread != b->tick_thread) || (b->tick_thread != c->tick_thread);
+			CHECK(used_several_threads);
+		}
+
+		SECTION("Without a worker pool the children still all tick")
+		{
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(synced);
+
+			Engine engine;
+			engine.load(model);
+			REQUIRE(engine.get_worker_pool() == nullptr);
+
+			sleepy_overlap_probe.reset(1);
+			engine.get_tick_plan().start();
+			engine.get_tick_plan().tick_root(make_root_tick_info(1, 50.0f));
+
+			CHECK(engine.find_instance<TickPlanSleepyWorkload>("sleepy_a")->tick_count.load() == 1);
+			CHECK(engine.find_instance<TickPlanSleepyWorkload>("sleepy_c")->tick_count.load() == 1);
+			CHECK(sleepy_overlap_probe.peak_in_flight.load() == 1);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/Dataflow")
+	{
+		// deliberately listed consumer-first, so model order alone would read stale values:
+		static const WorkloadSeed sink{TypeId("TickPlanConsumerWorkload"), StringView("df_sink"), 100.0f};
+		static const WorkloadSeed relay{TypeId("TickPlanRelayWorkload"), StringView("df_relay"), 100.0f};
+		static const WorkloadSeed producer{TypeId("TickPlanProducerWorkload"), StringView("df_producer"), 100.0f};
+		static const WorkloadSeed bystander{TypeId("TickPlanConsumerWorkload"), StringView("df_bystander"), 100.0f};
+
+		static const WorkloadSeed* const root_children[] = {&sink, &relay, &producer, &bystander};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("df_root"), 100.0f, root_children};
+		static const WorkloadSeed* const workloads[] = {&sink, &relay, &producer, &bystander, &root};
+
+		static const DataConnectionSeed producer_to_relay("df_producer.outputs.value", "df_relay.inputs.value");
+		static const DataConnectionSeed relay_to_sink("df_relay.outputs.value", "df_sink.inputs.value");
+		static const DataConnectionSeed* const connections[] = {&producer_to_relay, &relay_to_sink};
+
+		SECTION("Children are levelled by their connections and consumers see same-tick data")
+		{
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.use_data_connection_seeds(connections);
+			model.set_root_workload(root);
+			model.set_tick_scheduling_mode(TickSchedulingMode::Dataflow);
+			model.set_worker_thread_count(2);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			const auto& root_entry = tick_plan.get_entries()[0];
+			REQUIRE(root_entry.dataflow_levels_count == 3);
+
+			const auto level_of = [&](const char* name) -> int
+			{
+				const uint32_t entry_index = tick_plan.find_entry_index(*engine.find_instance_info(name));
+				for (uint32_t level = 0; level < root_entry.dataflow_levels_count; ++level)
+				{
+					const auto& level_range = tick_plan.get_dataflow_levels()[root_entry.dataflow_levels_begin + level];
+					for (uint32_t i = 0; i < level_range.count; ++i)
+					{
+						if (tick_plan.get_dataflow_level_entries()[level_range.begin + i] == entry_index)
+							return static_cast<int>(level);
+					}
+				}
+				return -1;
+			};
+
+			CHECK(level_of("df_producer") == 0);
+			CHECK(level_of("df_bystander") == 0);
+			CHECK(level_of("df_relay") == 1);
+			CHECK(level_of("df_sink") == 2);
+
+			tick_plan.start();
+			for (uint64_t tick = 1; tick <= 3; ++tick)
+			{
+				tick_plan.tick_root(make_root_tick_info(tick, 100.0f));
+			}
+
+			const auto* sink_ptr = engine.find_instance<TickPlanConsumerWorkload>("df_sink");
+			CHECK(sink_ptr->tick_count == 3);
+			CHECK(sink_ptr->last_seen_value == 4); // producer's 3rd value, +1 from the relay - all within the same tick
+		}
+
+		SECTION("Cycles between siblings are rejected at load")
+		{
+			static const WorkloadSeed relay_a{TypeId("TickPlanRelayWorkload"), StringView("df_cycle_a"), 100.0f};
+			static const WorkloadSeed relay_b{TypeId("TickPlanRelayWorkload"), StringView("df_cycle_b"), 100.0f};
+			static const WorkloadSeed* const cycle_children[] = {&relay_a, &relay_b};
+			static const WorkloadSeed cycle_root{TypeId("TickPlanContainerWorkload"), StringView("df_cycle_root"), 100.0f, cycle_children};
+			static const WorkloadSeed* const cycle_workloads[] = {&relay_a, &relay_b, &cycle_root};
+
+			static const DataConnectionSeed a_to_b("df_cycle_a.outputs.value", "df_cycle_b.inputs.value");
+			static const DataConnectionSeed b_to_a("df_cycle_b.outputs.value", "df_cycle_a.inputs.value");
+			static const DataConnectionSeed* const cycle_connections[] = {&a_to_b, &b_to_a};
+
+			Model model;
+			model.use_workload_seeds(cycle_workloads);
+			model.use_data_connection_seeds(cycle_connections);
+			model.set_root_workload(cycle_root);
+			model.set_tick_scheduling_mode(TickSchedulingMode::Dataflow);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "form a cycle");
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/Hyperperiod")
+	{
+		SECTION("Every rate is dispatched from a static slot table with slow workloads phase-balanced")
+		{
+			static const WorkloadSeed fast{TypeId("TickPlanConsumerWorkload"), StringView("hp_fast"), 1000.0f};
+			static const WorkloadSeed half{TypeId("TickPlanConsumerWorkload"), StringView("hp_half"), 500.0f};
+			static const WorkloadSeed slow_a{TypeId("TickPlanConsumerWorkload"), StringView("hp_slow_a"), 100.0f};
+			static const WorkloadSeed slow_b{TypeId("TickPlanConsumerWorkload"), StringView("hp_slow_b"), 100.0f};
+			static const WorkloadSeed slowest{TypeId("TickPlanConsumerWorkload"), StringView("hp_slowest"), 10.0f};
+
+			static const WorkloadSeed* const inner_children[] = {&slowest};
+			static const WorkloadSeed inner{TypeId("TickPlanContainerWorkload"), StringView("hp_inner"), 500.0f, inner_children};
+
+			static const WorkloadSeed* const root_children[] = {&fast, &half, &slow_a, &slow_b, &inner};
+			static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("hp_root"), 1000.0f, root_children};
+
+			static const WorkloadSeed* const workloads[] = {&fast, &half, &slow_a, &slow_b, &slowest, &inner, &root};
+
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(root);
+			model.set_tick_scheduling_mode(TickSchedulingMode::Hyperperiod);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			const auto& entries = tick_plan.get_entries();
+			const auto entry_of = [&](const char* name) -> const TickPlanEntry&
+			{ return entries[tick_plan.find_entry_index(*engine.find_instance_info(name))]; };
+
+			// 1 kHz root; 1, 2, 10, 10, 2 and 2 * 50 root ticks per tick:
+			REQUIRE(tick_plan.get_hyperperiod_slot_count() == 100);
+			CHECK(entry_of("hp_fast").hyperperiod_divisor == 1);
+			CHECK(entry_of("hp_half").hyperperiod_divisor == 2);
+			CHECK(entry_of("hp_slow_a").hyperperiod_divisor == 10);
+			CHECK(entry_of("hp_slowest").hyperperiod_divisor == 100);
+
+			// equal-rate workloads are spread across different slots, and nested ones stay on their parent's ticks:
+			CHECK(entry_of("hp_slow_a").hyperperiod_phase != entry_of("hp_slow_b").hyperperiod_phase);
+			CHECK(entry_of("hp_slowest").hyperperiod_phase % 2 == entry_of("hp_inner").hyperperiod_phase);
+
+			// the container is listed just ahead of its child, on each of its own ticks:
+			const uint32_t inner_index = tick_plan.find_entry_index(*engine.find_instance_info("hp_inner"));
+			const auto& slot_offsets = tick_plan.get_hyperperiod_slot_offsets();
+			const auto& slot_entries = tick_plan.get_hyperperiod_slot_entries();
+			uint32_t inner_slot_count = 0;
+			for (uint32_t slot = 0; slot < tick_plan.get_hyperperiod_slot_count(); ++slot)
+			{
+				for (uint32_t i = slot_offsets[slot]; i < slot_offsets[slot + 1]; ++i)
+				{
+					if (slot_entries[i] != inner_index)
+						continue;
+
+					inner_slot_count++;
+					CHECK(slot % 2 == entry_of("hp_inner").hyperperiod_phase);
+					if (slot == entry_of("hp_slowest").hyperperiod_phase)
+					{
+						REQUIRE(i + 1 < slot_offsets[slot + 1]);
+						CHECK(slot_entries[i + 1] == inner_index + 1);
+					}
+				}
+			}
+			CHECK(inner_slot_count == 50);
+
+			tick_plan.start();
+			for (uint64_t tick = 1; tick <= 200; ++tick)
+			{
+				tick_plan.tick_root(make_root_tick_info(tick, 1000.0f));
+			}
+
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_fast")->tick_count == 200);
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_half")->tick_count == 100);
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_slow_a")->tick_count == 20);
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_slow_b")->tick_count == 20);
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_slowest")->tick_count == 2);
+
+			// containers record their own ticks, as they would ticking their children directly:
+			CHECK(engine.find_instance_info("hp_inner")->workload_stats->tick_count == 100);
+			CHECK(engine.find_instance_info("hp_slowest")->workload_stats->tick_count == 2);
+
+			// deltas are measured between the workload's own ticks, whatever its phase:
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_slow_b")->last_delta_time == Catch::Approx(0.01f));
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("hp_slowest")->last_delta_time == Catch::Approx(0.1f));
+		}
+
+		SECTION("Skipped containers, and a skipped root, hold back just what they would in Sequenced mode")
+		{
+			static const WorkloadSeed fast{TypeId("TickPlanProducerWorkload"), StringView("hps_fast"), 100.0f};
+			static const WorkloadSeed slow{TypeId("TickPlanProducerWorkload"), StringView("hps_slow"), 25.0f};
+			static const WorkloadSeed* const half_children[] = {&slow};
+			static const WorkloadSeed half{TypeId("TickPlanContainerWorkload"), StringView("hps_half"), 50.0f, half_children};
+
+			static const WorkloadSeed idle_child{TypeId("TickPlanProducerWorkload"), StringView("hps_idle_child"), 50.0f};
+			static const WorkloadSeed* const idle_group_children[] = {&idle_child};
+			static const WorkloadSeed idle_group{TypeId("TickPlanIdleGroupWorkload"), StringView("hps_idle_group"), 50.0f, idle_group_children};
+
+			static const WorkloadSeed disabled_child{TypeId("TickPlanProducerWorkload"), StringView("hps_disabled_child"), 100.0f};
+			static const WorkloadSeed* const disabled_group_children[] = {&disabled_child};
+			static const WorkloadSeed disabled_group{
+				TypeId("TickPlanContainerWorkload"), StringView("hps_disabled_group"), 100.0f, disabled_group_children};
+
+			static const WorkloadSeed idle{TypeId("TickPlanIdleWorkload"), StringView("hps_idle"), 100.0f};
+
+			static const WorkloadSeed* const root_children[] = {&fast, &half, &idle_group, &disabled_group, &idle};
+			static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("hps_root"), 100.0f, root_children};
+
+			static const WorkloadSeed* const workloads[] = {
+				&fast, &slow, &half, &idle_child, &idle_group, &disabled_child, &disabled_group, &idle, &root};
+
+			Model sequenced_model;
+			sequenced_model.use_workload_seeds(workloads);
+			sequenced_model.set_root_workload(root);
+
+			Model hyperperiod_model;
+			hyperperiod_model.use_workload_seeds(workloads);
+			hyperperiod_model.set_root_workload(root);
+			hyperperiod_model.set_tick_scheduling_mode(TickSchedulingMode::Hyperperiod);
+
+			Engine sequenced;
+			sequenced.load(sequenced_model);
+			Engine hyperperiod;
+			hyperperiod.load(hyperperiod_model);
+			REQUIRE(hyperperiod.get_tick_plan().get_hyperperiod_slot_count() == 4);
+
+			// two hyperperiods, then three ticks with the root disabled, then another - in both engines alike:
+			for (Engine* engine : {&sequenced, &hyperperiod})
+			{
+				TickPlan& tick_plan = engine->get_tick_plan();
+				tick_plan.set_entry_enabled(tick_plan.find_entry_index(*engine->find_instance_info("hps_disabled_group")), false);
+				tick_plan.start();
+
+				uint64_t tick = 1;
+				for (; tick <= 8; ++tick)
+					tick_plan.tick_root(make_root_tick_info(tick, 100.0f));
+
+				tick_plan.set_entry_enabled(0, false);
+				for (; tick <= 11; ++tick)
+					tick_plan.tick_root(make_root_tick_info(tick, 100.0f));
+
+				tick_plan.set_entry_enabled(0, true);
+				for (; tick <= 15; ++tick)
+					tick_plan.tick_root(make_root_tick_info(tick, 100.0f));
+			}
+
+			for (const WorkloadSeed* seed : workloads)
+			{
+				INFO(seed->unique_name.c_str());
+				const WorkloadInstanceStats* sequenced_stats = sequenced.find_instance_info(seed->unique_name.c_str())->workload_stats;
+				const WorkloadInstanceStats* hyperperiod_stats = hyperperiod.find_instance_info(seed->unique_name.c_str())->workload_stats;
+				CHECK(hyperperiod_stats->tick_count == sequenced_stats->tick_count);
+				CHECK(hyperperiod_stats->skipped_tick_count == sequenced_stats->skipped_tick_count);
+			}
+
+			CHECK(hyperperiod.find_instance<TickPlanProducerWorkload>("hps_fast")->outputs.value == 12);
+			CHECK(hyperperiod.find_instance<TickPlanProducerWorkload>("hps_slow")->outputs.value == 3);
+			CHECK(hyperperiod.find_instance<TickPlanProducerWorkload>("hps_idle_child")->outputs.value == 0);
+			CHECK(hyperperiod.find_instance<TickPlanProducerWorkload>("hps_disabled_child")->outputs.value == 0);
+			CHECK(hyperperiod.find_instance_info("hps_root")->workload_stats->skipped_tick_count == 3);
+		}
+
+		SECTION("Rates without a small common multiple are rejected at load")
+		{
+			static const WorkloadSeed odd_a{TypeId("TickPlanConsumerWorkload"), StringView("hp_odd_a"), 7.0f};
+			static const WorkloadSeed odd_b{TypeId("TickPlanConsumerWorkload"), StringView("hp_odd_b"), 3.0f};
+			static const WorkloadSeed odd_c{TypeId("TickPlanConsumerWorkload"), StringView("hp_odd_c"), 11.0f};
+
+			static const WorkloadSeed* const odd_children[] = {&odd_a, &odd_b, &odd_c};
+			static const WorkloadSeed odd_root{TypeId("TickPlanContainerWorkload"), StringView("hp_odd_root"), 1000.0f, odd_children};
+
+			static const WorkloadSeed* const odd_workloads[] = {&odd_a, &odd_b, &odd_c, &odd_root};
+
+			Model model;
+			model.use_workload_seeds(odd_workloads);
+			model.set_root_workload(odd_root);
+			model.set_tick_scheduling_mode(TickSchedulingMode::Hyperperiod);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "Hyperperiod of the model's tick-rates exceeds");
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/EventDriven")
+	{
+		static const WorkloadSeed producer{TypeId("TickPlanLatchProducerWorkload"), StringView("ev_producer"), 100.0f};
+		static const WorkloadSeed event_consumer{TypeId("TickPlanEventConsumerWorkload"), StringView("ev_consumer"), 100.0f};
+		static const WorkloadSeed periodic_consumer{TypeId("TickPlanConsumerWorkload"), StringView("ev_periodic_consumer"), 100.0f};
+		static const WorkloadSeed unconnected{TypeId("TickPlanEventConsumerWorkload"), StringView("ev_unconnected"), 100.0f};
+
+		static const WorkloadSeed* const root_children[] = {&producer, &event_consumer, &periodic_consumer, &unconnected};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("ev_root"), 100.0f, root_children};
+
+		static const WorkloadSeed* const workloads[] = {&producer, &event_consumer, &periodic_consumer, &unconnected, &root};
+
+		static const DataConnectionSeed to_event_consumer("ev_producer.outputs.value", "ev_consumer.inputs.value");
+		static const DataConnectionSeed to_periodic_consumer("ev_producer.outputs.value", "ev_periodic_consumer.inputs.value");
+		static const DataConnectionSeed* const connections[] = {&to_event_consumer, &to_periodic_consumer};
+
+		Model model;
+		model.use_workload_seeds(workloads);
+		model.use_data_connection_seeds(connections);
+		model.set_root_workload(root);
+
+		Engine engine;
+		engine.load(model);
+
+		TickPlan& tick_plan = engine.get_tick_plan();
+		auto* producer_ptr = engine.find_instance<TickPlanLatchProducerWorkload>("ev_producer");
+		auto* event_consumer_ptr = engine.find_instance<TickPlanEventConsumerWorkload>("ev_consumer");
+		const auto* periodic_consumer_ptr = engine.find_instance<TickPlanConsumerWorkload>("ev_periodic_consumer");
+		auto* unconnected_ptr = engine.find_instance<TickPlanEventConsumerWorkload>("ev_unconnected");
+
+		uint64_t tick = 0;
+		tick_plan.start();
+
+		// every workload gets an initial tick, after which the event-driven one idles while its inputs are unchanged:
+		tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+		tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+		CHECK(event_consumer_ptr->tick_count == 1);
+		CHECK(unconnected_ptr->tick_count == 1);
+		CHECK(periodic_consumer_ptr->tick_count == 2);
+
+		SECTION("A changed connection wakes it in the same tick")
+		{
+			producer_ptr->next_value = 5;
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(event_consumer_ptr->tick_count == 2);
+			CHECK(event_consumer_ptr->last_seen_value == 5);
+
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(event_consumer_ptr->tick_count == 2);
+			CHECK(periodic_consumer_ptr->tick_count == 4);
+		}
+
+		SECTION("Inputs written from outside the plan (remote fields, telemetry) wake it too")
+		{
+			unconnected_ptr->inputs.value = 42;
+			engine.notify_input_written(&unconnected_ptr->inputs.value);
+
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(unconnected_ptr->tick_count == 2);
+			CHECK(unconnected_ptr->last_seen_value == 42);
+
+			// pointers outside any workload are ignored:
+			int not_a_workload_field = 0;
+			engine.notify_input_written(&not_a_workload_field);
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(unconnected_ptr->tick_count == 2);
+			CHECK(event_consumer_ptr->tick_count == 1);
+		}
+
+		SECTION("A change delivered while it is disabled wakes it once re-enabled")
+		{
+			const uint32_t consumer_index = tick_plan.find_entry_index(*engine.find_instance_info("ev_consumer"));
+			tick_plan.set_entry_enabled(consumer_index, false);
+
+			producer_ptr->next_value = 7;
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(event_consumer_ptr->tick_count == 1);
+
+			tick_plan.set_entry_enabled(consumer_index, true);
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(event_consumer_ptr->tick_count == 2);
+			CHECK(event_consumer_ptr->last_seen_value == 7);
+
+			// and only once - the event went with that tick:
+			tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+			CHECK(event_consumer_ptr->tick_count == 2);
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/EventDrivenCacheAwareLayout")
+	{
+		// a CacheAware layout puts the root (listed last) first in the buffer, so offsets no longer follow model order:
+		static const WorkloadSeed first_consumer{TypeId("TickPlanEventConsumerWorkload"), StringView("evl_first"), 100.0f};
+		static const WorkloadSeed second_consumer{TypeId("TickPlanEventConsumerWorkload"), StringView("evl_second"), 100.0f};
+		static const WorkloadSeed* const root_children[] = {&second_consumer, &first_consumer};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("evl_root"), 100.0f, root_children};
+		static const WorkloadSeed* const workloads[] = {&first_consumer, &second_consumer, &root};
+
+		Model model;
+		model.use_workload_seeds(workloads);
+		model.set_root_workload(root);
+		model.set_workloads_layout(WorkloadsLayout::CacheAware);
+
+		Engine engine;
+		engine.load(model);
+
+		TickPlan& tick_plan = engine.get_tick_plan();
+		auto* first_ptr = engine.find_instance<TickPlanEventConsumerWorkload>("evl_first");
+		auto* second_ptr = engine.find_instance<TickPlanEventConsumerWorkload>("evl_second");
+		REQUIRE(engine.find_instance_info("evl_root")->offset_in_workloads_buffer <
+				engine.find_instance_info("evl_first")->offset_in_workloads_buffer);
+
+		uint64_t tick = 0;
+		tick_plan.start();
+		tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+
+		first_ptr->inputs.value = 7;
+		engine.notify_input_written(&first_ptr->inputs.value);
+		tick_plan.tick_root(make_root_tick_info(++tick, 100.0f));
+
+		CHECK(first_ptr->tick_count == 2);
+		CHECK(first_ptr->last_seen_value == 7);
+		CHECK(second_ptr->tick_count == 1);
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/Placement")
+	{
+		static const WorkloadSeed vision_child{TypeId("TickPlanThreadProbeWorkload"), StringView("pl_vision_child"), 50.0f};
+		static const WorkloadSeed* const vision_children[] = {&vision_child};
+		static const WorkloadSeed vision{TypeId("TickPlanContainerWorkload"), StringView("pl_vision"), 50.0f, vision_children};
+		static const WorkloadSeed control{TypeId("TickPlanThreadProbeWorkload"), StringView("pl_control"), 50.0f};
+
+		static const WorkloadSeed* const root_children[] = {&vision, &control};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("pl_root"), 50.0f, root_children};
+
+		static const WorkloadSeed* const workloads[] = {&vision_child, &vision, &control, &root};
+
+		Model model;
+		model.use_workload_seeds(workloads);
+		thread_overlap_probe.reset(1);
+
+		SECTION("A placed subtree ticks on its own thread, alongside its siblings, within the parent's tick")
+		{
+			static const WorkloadPlacementSeed vision_placement("pl_vision", -1, true, 0);
+			static const WorkloadPlacementSeed* const placements[] = {&vision_placement};
+			model.use_workload_placements(placements);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			REQUIRE(tick_plan.get_dedicated_threads().size() == 1);
+
+			const auto* vision_child_ptr = engine.find_instance<TickPlanThreadProbeWorkload>("pl_vision_child");
+			const auto* control_ptr = engine.find_instance<TickPlanThreadProbeWorkload>("pl_control");
+
+			tick_plan.start();
+			CHECK(vision_child_ptr->start_thread != 0);
+			CHECK(vision_child_ptr->start_thread != Thread::get_current_thread_id());
+			CHECK(control_ptr->start_thread == Thread::get_current_thread_id());
+
+			thread_overlap_probe.reset(2);
+			tick_plan.tick_root(make_root_tick_info(1, 50.0f));
+
+			CHECK(vision_child_ptr->tick_count.load() == 1);
+			CHECK(control_ptr->tick_count.load() == 1);
+			CHECK(vision_child_ptr->tick_thread == vision_child_ptr->start_thread);
+			CHECK(control_ptr->tick_thread == Thread::get_current_thread_id());
+
+			// both were ticking at once:
+			CHECK(thread_overlap_probe.peak_in_flight.load() == 2);
+
+			tick_plan.tick_root(make_root_tick_info(2, 50.0f));
+			CHECK(vision_child_ptr->tick_count.load() == 2);
+
+			tick_plan.stop();
+			CHECK(tick_plan.get_dedicated_threads()[0].is_started == false);
+		}
+
+		SECTION("A core pin implies a dedicated thread, pinned to that core")
+		{
+			cpu_set_t allowed_cpus;
+			REQUIRE(::sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) == 0);
+			int core = 0;
+			while (!CPU_ISSET(core, &allowed_cpus))
+				core++;
+
+			static WorkloadPlacementSeed control_placement("pl_control", -1);
+			control_placement.core = core;
+			static const WorkloadPlacementSeed* const placements[] = {&control_placement};
+			model.use_workload_placements(placements);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			REQUIRE(tick_plan.get_dedicated_threads().size() == 1);
+
+			tick_plan.start();
+			tick_plan.tick_root(make_root_tick_info(1, 50.0f));
+			tick_plan.stop();
+
+			const auto* control_ptr = engine.find_instance<TickPlanThreadProbeWorkload>("pl_control");
+			CHECK(control_ptr->tick_thread != Thread::get_current_thread_id());
+			CHECK(control_ptr->tick_cpu == core);
+		}
+
+		SECTION("Placements must name a workload, once")
+		{
+			static const WorkloadPlacementSeed unknown_placement("pl_missing", 0);
+			static const WorkloadPlacementSeed* const unknown_placements[] = {&unknown_placement};
+			model.use_workload_placements(unknown_placements);
+			ROBOTICK_REQUIRE_ERROR_MSG(model.set_root_workload(root), "no workload named 'pl_missing'");
+
+			static const WorkloadPlacementSeed first_placement("pl_control", -1, true);
+			static const WorkloadPlacementSeed second_placement("pl_control", 1);
+			static const WorkloadPlacementSeed* const duplicate_placements[] = {&first_placement, &second_placement};
+			model.use_workload_placements(duplicate_placements);
+			ROBOTICK_REQUIRE_ERROR_MSG(model.set_root_workload(root), "is placed more than once");
+		}
+
+		SECTION("Hyperperiod scheduling can't hand subtrees to dedicated threads")
+		{
+			static const WorkloadPlacementSeed vision_placement("pl_vision", -1, true);
+			static const WorkloadPlacementSeed* const placements[] = {&vision_placement};
+			model.use_workload_placements(placements);
+			model.set_root_workload(root);
+			model.set_tick_scheduling_mode(TickSchedulingMode::Hyperperiod);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "not supported with TickSchedulingMode::Hyperperiod");
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/Instanced")
+	{
+		static const FieldConfigEntry joint_config[] = {{"gain", "3"}};
+
+		static const WorkloadSeed producer{TypeId("TickPlanLatchProducerWorkload"), StringView("inst_producer"), 100.0f};
+		static const WorkloadSeed joints{
+			TypeId("TickPlanJointWorkload"), StringView("inst_joints"), WorkloadInstanceCount(16), 100.0f, joint_config};
+		static const WorkloadSeed trackers{TypeId("TickPlanConsumerWorkload"), StringView("inst_trackers"), WorkloadInstanceCount(4), 100.0f};
+		static const WorkloadSeed consumer{TypeId("TickPlanConsumerWorkload"), StringView("inst_consumer"), 100.0f};
+
+		static const WorkloadSeed* const root_children[] = {&producer, &joints, &trackers, &consumer};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("inst_root"), 100.0f, root_children};
+
+		static const WorkloadSeed* const workloads[] = {&producer, &joints, &trackers, &consumer, &root};
+
+		Model model;
+		model.use_workload_seeds(workloads);
+
+		SECTION("Elements are stored contiguously, ticked in one batch, and addressable by index")
+		{
+			static const DataConnectionSeed to_joint("inst_producer.outputs.value", "inst_joints[12].inputs.value");
+			static const DataConnectionSeed from_joint("inst_joints[12].outputs.value", "inst_consumer.inputs.value");
+			static const DataConnectionSeed* const connections[] = {&to_joint, &from_joint};
+			model.use_data_connection_seeds(connections);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			const WorkloadInstanceInfo* joints_info = engine.find_instance_info("inst_joints");
+			REQUIRE(joints_info != nullptr);
+			CHECK(joints_info->instance_count == 16);
+			CHECK(joints_info->get_size() == 16 * sizeof(TickPlanJointWorkload));
+
+			auto* first_joint = engine.find_instance<TickPlanJointWorkload>("inst_joints");
+			for (int i = 0; i < 16; ++i)
+				CHECK(first_joint[i].config.gain == 3);
+
+			const FieldInfo torque_field = DataConnectionUtils::find_field_info(engine, "inst_joints[5].outputs.value");
+			CHECK(torque_field.ptr == &first_joint[5].outputs.value);
+			CHECK(DataConnectionUtils::find_field_info(engine, "inst_joints[16].outputs.value").ptr == nullptr);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			engine.find_instance<TickPlanLatchProducerWorkload>("inst_producer")->next_value = 7;
+
+			TickPlanJointWorkload::batch_call_count = 0;
+			tick_plan.start();
+			tick_plan.tick_root(make_root_tick_info(1, 100.0f));
+			tick_plan.tick_root(make_root_tick_info(2, 100.0f));
+
+			CHECK(TickPlanJointWorkload::batch_call_count == 2);
+			CHECK(TickPlanJointWorkload::last_batch_size == 16);
+			CHECK(first_joint[12].outputs.value == 21);
+			CHECK(first_joint[11].outputs.value == 0);
+			CHECK(engine.find_instance<TickPlanConsumerWorkload>("inst_consumer")->last_seen_value == 21);
+
+			// a type without tick_batch() still has each of its elements ticked:
+			const auto* first_tracker = engine.find_instance<TickPlanConsumerWorkload>("inst_trackers");
+			for (int i = 0; i < 4; ++i)
+				CHECK(first_tracker[i].tick_count == 2);
+		}
+
+		SECTION("Instanced workloads must be indexed, within range")
+		{
+			static const DataConnectionSeed unindexed("inst_producer.outputs.value", "inst_joints.inputs.value");
+			static const DataConnectionSeed* const connections[] = {&unindexed};
+			model.use_data_connection_seeds(connections);
+			model.set_root_workload(root);
+
+			Engine engine;
+			ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "invalid element index");
+		}
+
+		SECTION("Instanced workloads cannot be the root")
+		{
+			static const WorkloadSeed instanced_root{
+				TypeId("TickPlanConsumerWorkload"), StringView("inst_instanced_root"), WorkloadInstanceCount(2), 100.0f};
+			static const WorkloadSeed* const root_workloads[] = {&instanced_root};
+
+			Model root_model;
+			root_model.use_workload_seeds(root_workloads);
+			ROBOTICK_REQUIRE_ERROR_MSG(root_model.set_root_workload(instanced_root), "cannot have children or be the root");
+		}
+	}
+
+	TEST_CASE("Unit/Framework/Scheduling/TickPlan/EnableMask")
+	{
+		static const WorkloadSeed modes{TypeId("TickPlanModeWorkload"), StringView("enable_modes"), 100.0f};
+		static const WorkloadSeed nav_producer{TypeId("TickPlanProducerWorkload"), StringView("enable_nav_producer"), 100.0f};
+		static const WorkloadSeed* const nav_children[] = {&nav_producer};
+		static const WorkloadSeed nav{TypeId("TickPlanContainerWorkload"), StringView("enable_nav"), 100.0f, nav_children};
+		static const WorkloadSeed idle{TypeId("TickPlanIdleWorkload"), StringView("enable_idle"), 100.0f};
+
+		static const WorkloadSeed* const root_children[] = {&modes, &nav, &idle};
+		static const WorkloadSeed root{TypeId("TickPlanContainerWorkload"), StringView("enable_root"), 100.0f, root_children};
+
+		static const WorkloadSeed* const workloads[] = {&modes, &nav_producer, &nav, &idle, &root};
+
+		Model model;
+		model.set_telemetry_port(choose_telemetry_port());
+		model.use_workload_seeds(workloads);
+
+		SECTION("An enable field switches its subtree off without ticking any of it")
+		{
+			static const WorkloadEnableSeed nav_enable{"enable_nav", "enable_modes.outputs.nav_enabled"};
+			static const WorkloadEnableSeed* const enables[] = {&nav_enable};
+			model.use_workload_enables(enables);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			auto* mode_workload = engine.find_instance<TickPlanModeWorkload>("enable_modes");
+			const auto* producer = engine.find_instance<TickPlanProducerWorkload>("enable_nav_producer");
+			const WorkloadInstanceStats* nav_stats = engine.find_instance_info("enable_nav")->workload_stats;
+
+			AtomicFlag stop_flag;
+			engine.run_virtual_time(stop_flag, 3);
+			CHECK(producer->outputs.value == 3);
+			CHECK(nav_stats->skipped_tick_count == 0);
+
+			mode_workload->outputs.nav_enabled = false;
+			engine.run_virtual_time(stop_flag, 3);
+			CHECK(producer->outputs.value == 3);
+			CHECK(nav_stats->skipped_tick_count == 3);
+			CHECK_FALSE(engine.get_tick_plan().is_entry_enabled(engine.get_tick_plan().find_entry_index(*engine.find_instance_info("enable_nav"))));
+
+			// only the top of the skipped subtree counts it - the rest was never visited:
+			CHECK(engine.find_instance_info("enable_nav_producer")->workload_stats->skipped_tick_count == 0);
+
+			mode_workload->outputs.nav_enabled = true;
+			engine.run_virtual_time(stop_flag, 2);
+			CHECK(producer->outputs.value == 5);
+		}
+
+		SECTION("Workloads without work are skipped, and counted apart from their ticks")
+		{
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			auto* idle_workload = engine.find_instance<TickPlanIdleWorkload>("enable_idle");
+			const WorkloadInstanceStats* idle_stats = engine.find_instance_info("enable_idle")->workload_stats;
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			tick_plan.start();
+			tick_plan.tick_root(make_root_tick_info(1, 100.0f));
+			tick_plan.tick_root(make_root_tick_info(2, 100.0f));
+			CHECK(idle_workload->tick_count == 0);
+			CHECK(idle_stats->skipped_tick_count == 2);
+			CHECK(idle_stats->tick_count == 0);
+
+			idle_workload->has_queued_work = true;
+			tick_plan.tick_root(make_root_tick_info(3, 100.0f));
+			CHECK(idle_workload->tick_count == 1);
+			CHECK(idle_stats->skipped_tick_count == 2);
+			CHECK(idle_stats->tick_count == 1);
+		}
+
+		SECTION("Disabling a group also holds back its children in Hyperperiod mode")
+		{
+			model.set_tick_scheduling_mode(TickSchedulingMode::Hyperperiod);
+			model.set_root_workload(root);
+
+			Engine engine;
+			engine.load(model);
+
+			TickPlan& tick_plan = engine.get_tick_plan();
+			REQUIRE(tick_plan.get_hyperperiod_slot_count() > 0);
+
+			const auto* producer = engine.find_instance<TickPlanProducerWorkload>("enable_nav_producer");
+			tick_plan.set_entry_enabled(tick_plan.find_entry_index(*engine.find_instance_info("enable_nav")), false);
+
+			tick_plan.start();
+			tick_plan.tick_root(make_root_tick_info(1, 100.0f));
+			tick_plan.tick_root(make_root_tick_info(2, 100.0f));
+			CHECK(producer->outputs.value == 0);
+
+			// (just as in Sequenced mode, only the top of the skipped subtree counts it)
+			CHECK(engine.find_instance_info("enable_nav")->workload_stats->skipped_tick_count == 2);
+			CHECK(engine.find_instance_info("enable_nav_producer")->workload_stats->skipped_tick_count == 0);
+		}
+
+		SECTION("Enable fields must exist and be bools")
+		{
+			SECTION("Unknown workload")
+			{
+				static const WorkloadEnableSeed enable{"enable_missing", "enable_modes.outputs.nav_enabled"};
+				static const WorkloadEnableSeed* const enables[] = {&enable};
+				model.use_workload_enables(enables);
+				ROBOTICK_REQUIRE_ERROR_MSG(model.set_root_workload(root), "no workload named 'enable_missing'");
+			}
+
+			SECTION("Non-bool field")
+			{
+				static const WorkloadEnableSeed enable{"enable_nav", "enable_modes.outputs.speed"};
+				static const WorkloadEnableSeed* const enables[] = {&enable};
+				model.use_workload_enables(enables);
+				model.set_root_workload(root);
+
+				Engine engine;
+				ROBOTICK_REQUIRE_ERROR_MSG(engine.load(model), "must be a bool");
+			}
+		}
+	}
+
+} // namespace robotick::test
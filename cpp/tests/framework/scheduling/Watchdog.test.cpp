@@ -0,0 +1,241 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/scheduling/Watchdog.h"
+#include "robotick/api.h"
+#include "robotick/config/AssertUtils.h"
+#include "robotick/framework/Engine.h"
+#include "robotick/framework/concurrency/Atomic.h"
+#include "robotick/framework/model/Model.h"
+#include "robotick/framework/registry/TypeRegistry.h"
+#include "robotick/framework/scheduling/TickPlan.h"
+#include "robotick/framework/time/Clock.h"
+#include "../utils/TelemetryTestUtils.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		// overruns its watchdog budget on every tick - by checking the watchdog at a time just past it, rather than sleeping
+		struct WatchdogSleepyWorkload
+		{
+			uint32_t tick_count = 0;
+			Watchdog* watchdog = nullptr;
+			const TickPlanEntry* entry = nullptr;
+
+			void tick(const TickInfo&)
+			{
+				tick_count++;
+				if (watchdog != nullptr)
+					watchdog->check(entry->watchdog_tick_start_ns.load() + entry->watchdog_budget_ns + 1);
+			}
+		};
+		ROBOTICK_REGISTER_WORKLOAD(WatchdogSleepyWorkload)
+
+		struct WatchdogContainerWorkload
+		{
+		};
+		ROBOTICK_REGISTER_WORKLOAD(WatchdogContainerWorkload)
+
+		struct WatchdogTestModel
+		{
+			const WorkloadSeed sleepy_seed{TypeId("WatchdogSleepyWorkload"), StringView("sleepy"), 100.0f};
+			const WorkloadSeed* const children[1] = {&sleepy_seed};
+			const WorkloadSeed root_seed{TypeId("WatchdogContainerWorkload"), StringView("root"), 100.0f, children};
+			const WorkloadSeed* const workloads[2] = {&root_seed, &sleepy_seed};
+
+			WorkloadWatchdogSeed watchdog_seed;
+			const WorkloadWatchdogSeed* const watchdogs[1] = {&watchdog_seed};
+
+			const WorkloadPlacementSeed placement_seed{"sleepy", -1, true};
+			const WorkloadPlacementSeed* const placements[1] = {&placement_seed};
+
+			Model model;
+
+			// (a budget long enough that the watchdog's own thread never trips on the real clock - only the workload's checks do)
+			explicit WatchdogTestModel(WatchdogAction action, bool is_sleepy_dedicated = false)
+				: watchdog_seed("sleepy", 10000.0f, action)
+			{
+				model.set_telemetry_port(choose_telemetry_port());
+				model.use_workload_seeds(workloads);
+				if (is_sleepy_dedicated)
+					model.use_workload_placements(placements);
+				model.set_root_workload(root_seed, false);
+				model.use_workload_watchdogs(watchdogs);
+				model.finalize();
+			}
+		};
+
+		const TickPlanEntry& find_entry(const Engine& engine, const char* unique_name)
+		{
+			const WorkloadInstanceInfo* instance_info = engine.find_instance_info(unique_name);
+			const TickPlanEntry* found_entry = nullptr;
+			for (const TickPlanEntry& entry : engine.get_tick_plan().get_entries())
+			{
+				if (entry.instance_info == instance_info)
+					found_entry = &entry;
+			}
+			ROBOTICK_ASSERT_MSG(found_entry != nullptr, "No tick plan entry for '%s'", unique_name);
+			return *found_entry;
+		}
+
+		WatchdogSleepyWorkload& load_sleepy(Engine& engine, const Model& model)
+		{
+			engine.load(model);
+
+			auto* sleepy = engine.find_instance<WatchdogSleepyWorkload>("sleepy");
+			sleepy->watchdog = &engine.get_watchdog();
+			sleepy->entry = &find_entry(engine, "sleepy");
+			return *sleepy;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Scheduling/Watchdog")
+	{
+		SECTION("Log reports every overrunning tick but leaves the workload ticking")
+		{
+			WatchdogTestModel test_model(WatchdogAction::Log);
+			Engine engine;
+			WatchdogSleepyWorkload& sleepy = load_sleepy(engine, test_model.model);
+
+			AtomicFlag stop_flag;
+			engine.run_virtual_time(stop_flag, 3);
+
+			CHECK(sleepy.tick_count == 3);
+			CHECK(engine.find_instance_info("sleepy")->workload_stats->watchdog_trip_count == 3);
+			CHECK_FALSE(engine.is_stop_requested());
+		}
+
+		SECTION("SkipTicks stops ticking the workload once it has tripped")
+		{
+			WatchdogTestModel test_model(WatchdogAction::SkipTicks);
+			Engine engine;
+			WatchdogSleepyWorkload& sleepy = load_sleepy(engine, test_model.model);
+
+			AtomicFlag stop_flag;
+			engine.run_virtual_time(stop_flag, 4);
+
+			CHECK(sleepy.tick_count == 1);
+			CHECK(engine.find_instance_info("sleepy")->workload_stats->watchdog_trip_count == 1);
+			CHECK_FALSE(engine.is_stop_requested());
+		}
+
+		SECTION("A dedicated thread is forgotten once it exits, so it's never sampled after")
+		{
+			WatchdogTestModel test_model(WatchdogAction::Log, true);
+			Engine engine;
+			WatchdogSleepyWorkload& sleepy = load_sleepy(engine, test_model.model);
+
+			AtomicFlag stop_flag;
+			engine.run_virtual_time(stop_flag, 2);
+
+			CHECK(sleepy.tick_count == 2);
+			CHECK(engine.find_instance_info("sleepy")->workload_stats->watchdog_trip_count == 2);
+			CHECK(find_entry(engine, "sleepy").watchdog_tick_thread.load() == 0);
+		}
+
+		SECTION("Stop ends the run after the overrunning tick")
+		{
+			WatchdogTestModel test_model(WatchdogAction::Stop);
+			Engine engine;
+			WatchdogSleepyWorkload& sleepy = load_sleepy(engine, test_model.model);
+
+			AtomicFlag stop_flag;
+			engine.run_virtual_time(stop_flag); // no tick limit - only the watchdog stops it
+
+			CHECK(sleepy.tick_count == 1);
+			CHECK(engine.is_stop_requested());
+		}
+
+		SECTION("A tick trips once it has run past its budget, and only once")
+		{
+			WatchdogTestModel test_model(WatchdogAction::Log);
+			Engine engine;
+			engine.load(test_model.model);
+
+			TickPlanEntry& entry = const_cast<TickPlanEntry&>(find_entry(engine, "sleepy"));
+			const uint32_t& trip_count = engine.find_instance_info("sleepy")->workload_stats->watchdog_trip_count;
+
+			Watchdog watchdog;
+			watchdog.start(engine.get_tick_plan());
+
+			// (as though the tick had just begun, and was still running)
+			const uint64_t tick_start_ns = static_cast<uint64_t>(Clock::to_nanoseconds(Clock::now().time_since_epoch()).count());
+			entry.watchdog_tick_start_ns.store(tick_start_ns);
+
+			watchdog.check(tick_start_ns + entry.watchdog_budget_ns);
+			CHECK(trip_count == 0);
+
+			watchdog.check(tick_start_ns + entry.watchdog_budget_ns + 1);
+			watchdog.check(tick_start_ns + 2 * entry.watchdog_budget_ns);
+			CHECK(trip_count == 1);
+
+			// a later overrunning tick trips again - and an idle entry never does:
+			entry.watchdog_tick_start_ns.store(tick_start_ns + 3 * entry.watchdog_budget_ns);
+			watchdog.check(tick_start_ns + 5 * entry.watchdog_budget_ns);
+			CHECK(trip_count == 2);
+
+			entry.watchdog_tick_start_ns.store(0);
+			watchdog.check(tick_start_ns + 10 * entry.watchdog_budget_ns);
+			CHECK(trip_count == 2);
+
+			watchdog.stop();
+		}
+
+		SECTION("Unwatched workloads start no watchdog thread")
+		{
+			Watchdog watchdog;
+			WatchdogTestModel test_model(WatchdogAction::Log);
+			Engine engine;
+			engine.load(test_model.model);
+
+			// a fresh plan with no watched entries:
+			TickPlan unwatched_plan;
+			watchdog.start(unwatched_plan);
+			CHECK_FALSE(watchdog.is_running());
+
+			watchdog.start(engine.get_tick_plan());
+			CHECK(watchdog.is_running());
+			watchdog.stop();
+			CHECK_FALSE(watchdog.is_running());
+		}
+
+		SECTION("Model rejects invalid watchdogs")
+		{
+			static const WorkloadSeed seed{TypeId("WatchdogSleepyWorkload"), StringView("sleepy"), 100.0f};
+			static const WorkloadSeed* const workloads[] = {&seed};
+
+			Model model;
+			model.use_workload_seeds(workloads);
+			model.set_root_workload(seed, false);
+
+			SECTION("Unknown workload")
+			{
+				static const WorkloadWatchdogSeed watchdog{"missing", 5.0f};
+				static const WorkloadWatchdogSeed* const watchdogs[] = {&watchdog};
+				model.use_workload_watchdogs(watchdogs);
+				ROBOTICK_REQUIRE_ERROR_MSG(model.finalize(), "no workload named 'missing'");
+			}
+
+			SECTION("Non-positive budget")
+			{
+				static const WorkloadWatchdogSeed watchdog{"sleepy", 0.0f};
+				static const WorkloadWatchdogSeed* const watchdogs[] = {&watchdog};
+				model.use_workload_watchdogs(watchdogs);
+				ROBOTICK_REQUIRE_ERROR_MSG(model.finalize(), "invalid budget");
+			}
+
+			SECTION("Duplicate watchdog")
+			{
+				static const WorkloadWatchdogSeed first{"sleepy", 5.0f};
+				static const WorkloadWatchdogSeed second{"sleepy", 10.0f, WatchdogAction::Stop};
+				static const WorkloadWatchdogSeed* const watchdogs[] = {&first, &second};
+				model.use_workload_watchdogs(watchdogs);
+				ROBOTICK_REQUIRE_ERROR_MSG(model.finalize(), "has more than one watchdog");
+			}
+		}
+	}
+
+} // namespace robotick::test
@@ -0,0 +1,81 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#include "robotick/framework/time/TickTimer.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace robotick::test
+{
+	namespace
+	{
+		// sleeps to a series of deadlines 1ms apart, checking we never wake early and returning the worst reported lateness
+		uint32_t sleep_through_deadlines(TickTimer& tick_timer, int count)
+		{
+			uint32_t max_jitter_ns = 0;
+			auto target_time = Clock::now();
+
+			for (int i = 0; i < count; ++i)
+			{
+				target_time += Clock::from_seconds(0.001);
+				const uint32_t jitter_ns = tick_timer.sleep_until(target_time);
+
+				CHECK(Clock::now() >= target_time);
+				if (jitter_ns > max_jitter_ns)
+					max_jitter_ns = jitter_ns;
+			}
+
+			return max_jitter_ns;
+		}
+	} // namespace
+
+	TEST_CASE("Unit/Framework/Time/TickTimer")
+	{
+		TickTimer tick_timer;
+
+		SECTION("Every backend waits until the deadline and reports how late it woke")
+		{
+			const TickTimerBackend backends[] = {TickTimerBackend::Hybrid,
+				TickTimerBackend::AbsoluteSleep,
+				TickTimerBackend::TimerFd,
+				TickTimerBackend::Spin,
+				TickTimerBackend::AdaptiveHybrid};
+
+			for (const TickTimerBackend backend : backends)
+			{
+				tick_timer.start(backend);
+
+				// generous bound - this only guards against a backend that ignores its deadline:
+				CHECK(sleep_through_deadlines(tick_timer, 10) < 50000000u);
+
+				tick_timer.stop();
+			}
+		}
+
+		SECTION("Deadlines already in the past return straight away")
+		{
+			tick_timer.start(TickTimerBackend::TimerFd);
+
+			const auto target_time = Clock::now() - Clock::from_seconds(0.01);
+			CHECK(tick_timer.sleep_until(target_time) >= 10000000u);
+		}
+
+		SECTION("AdaptiveHybrid learns a tighter spin margin than the fixed hybrid")
+		{
+			tick_timer.start(TickTimerBackend::AdaptiveHybrid);
+			CHECK(tick_timer.get_adaptive_margin_ns() == TickTimer::ADAPTIVE_MAX_MARGIN_NS);
+
+			// 5ms apart, so each deadline leaves room to sleep before the margin:
+			auto target_time = Clock::now();
+			for (int i = 0; i < 40; ++i)
+			{
+				target_time += Clock::from_seconds(0.005);
+				tick_timer.sleep_until(target_time);
+			}
+
+			CHECK(tick_timer.get_adaptive_margin_ns() >= TickTimer::ADAPTIVE_MIN_MARGIN_NS);
+			CHECK(tick_timer.get_adaptive_margin_ns() < TickTimer::ADAPTIVE_MAX_MARGIN_NS);
+		}
+	}
+
+} // namespace robotick::test
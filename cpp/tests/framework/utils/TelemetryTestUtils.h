@@ -0,0 +1,59 @@
+// Copyright Robotick contributors
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "robotick/api.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace robotick::test
+{
+	inline uint16_t find_free_port_for_test()
+	{
+		int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+		if (sock < 0)
+			return 0;
+
+		sockaddr_in addr{};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_ANY);
+		addr.sin_port = 0;
+
+		if (::bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+		{
+			::close(sock);
+			return 0;
+		}
+
+		socklen_t addr_len = sizeof(addr);
+		if (::getsockname(sock, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0)
+		{
+			::close(sock);
+			return 0;
+		}
+
+		const uint16_t port = ntohs(addr.sin_port);
+		::close(sock);
+		// NOTE: this is still vulnerable to a TOCTOU race—the port is released before the Engine binds, so another
+		// process could grab it. We accept occasional flake on busy hosts, or keep extending the search loop if needed.
+		return port;
+	}
+
+	// a free port for a test model's telemetry server, so tests (and test runs) never contend for a fixed one
+	inline uint16_t choose_telemetry_port()
+	{
+		for (int attempt = 0; attempt < 3; ++attempt)
+		{
+			const uint16_t port = find_free_port_for_test();
+			if (port != 0)
+				return port;
+		}
+		ROBOTICK_FATAL_EXIT("Test: no free telemetry port found after 3 attempts");
+		return 0;
+	}
+
+} // namespace robotick::test